@@ -0,0 +1,11 @@
+#ifndef ALLOCCOUNTER_H
+#define ALLOCCOUNTER_H
+
+#include <cstddef>
+
+// Счетчик выделений памяти для бенчмарков аллокаций. alloccounter.cpp
+// заменяет глобальные operator new/delete (обычные, массивные и с размером),
+// поэтому подключается только к бенчмарку.
+size_t allocationCount();
+
+#endif
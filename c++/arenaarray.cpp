@@ -0,0 +1,312 @@
+#include "arenaarray.h"
+#include <cstring>
+
+ArenaArray::ArenaArray()
+    : bytes(nullptr), bytesUsed(0), bytesCapacity(0), garbageBytes(0),
+      slots(nullptr), capacity(0), currentSize(0) {}
+
+ArenaArray::ArenaArray(const ArenaArray& other) : ArenaArray() {
+    *this = other;
+}
+
+ArenaArray::ArenaArray(ArenaArray&& other) noexcept
+    : bytes(other.bytes), bytesUsed(other.bytesUsed), bytesCapacity(other.bytesCapacity),
+      garbageBytes(other.garbageBytes), slots(other.slots), capacity(other.capacity),
+      currentSize(other.currentSize) {
+    other.bytes = nullptr;
+    other.slots = nullptr;
+    other.bytesUsed = other.bytesCapacity = other.garbageBytes = 0;
+    other.capacity = other.currentSize = 0;
+}
+
+ArenaArray& ArenaArray::operator=(const ArenaArray& other) {
+    if (this != &other) {
+        // Копия сразу получается уплотненной
+        clear();
+        resizeSlots(other.currentSize);
+        reserveBytes(other.bytesUsed - other.garbageBytes);
+        for (size_t i = 0; i < other.currentSize; ++i) {
+            slots[i] = appendBytes(other.view(i));
+        }
+        currentSize = other.currentSize;
+    }
+    return *this;
+}
+
+ArenaArray& ArenaArray::operator=(ArenaArray&& other) noexcept {
+    if (this != &other) {
+        delete[] bytes;
+        delete[] slots;
+        bytes = other.bytes;
+        bytesUsed = other.bytesUsed;
+        bytesCapacity = other.bytesCapacity;
+        garbageBytes = other.garbageBytes;
+        slots = other.slots;
+        capacity = other.capacity;
+        currentSize = other.currentSize;
+        other.bytes = nullptr;
+        other.slots = nullptr;
+        other.bytesUsed = other.bytesCapacity = other.garbageBytes = 0;
+        other.capacity = other.currentSize = 0;
+    }
+    return *this;
+}
+
+ArenaArray::~ArenaArray() {
+    delete[] bytes;
+    delete[] slots;
+}
+
+void ArenaArray::resizeSlots(size_t newCapacity) {
+    if (newCapacity <= capacity) {
+        return;
+    }
+    Slot* newSlots = new Slot[newCapacity];
+    if (currentSize > 0) {
+        std::memcpy(newSlots, slots, currentSize * sizeof(Slot));
+    }
+    delete[] slots;
+    slots = newSlots;
+    capacity = newCapacity;
+}
+
+void ArenaArray::reserveBytes(size_t additional) {
+    size_t required = bytesUsed + additional;
+    if (required > MAX_ARENA_BYTES) {
+        throw std::length_error("Arena size limit exceeded");
+    }
+    if (required <= bytesCapacity) {
+        return;
+    }
+    size_t newCapacity = (bytesCapacity == 0) ? 64 : bytesCapacity * 2;
+    while (newCapacity < required) {
+        newCapacity *= 2;
+    }
+    char* newBytes = new char[newCapacity];
+    if (bytesUsed > 0) {
+        std::memcpy(newBytes, bytes, bytesUsed);
+    }
+    delete[] bytes;
+    bytes = newBytes;
+    bytesCapacity = newCapacity;
+}
+
+ArenaArray::Slot ArenaArray::appendBytes(std::string_view value) {
+    // Значение может указывать внутрь собственной арены (set(i, view(j)))
+    bool aliased = bytes != nullptr && value.data() >= bytes && value.data() < bytes + bytesUsed;
+    size_t aliasOffset = aliased ? static_cast<size_t>(value.data() - bytes) : 0;
+    
+    reserveBytes(value.size());
+    const char* source = aliased ? bytes + aliasOffset : value.data();
+    if (!value.empty()) {
+        std::memmove(bytes + bytesUsed, source, value.size());
+    }
+    
+    Slot slot{static_cast<uint32_t>(bytesUsed), static_cast<uint32_t>(value.size())};
+    bytesUsed += value.size();
+    return slot;
+}
+
+void ArenaArray::compactIfWasteful() {
+    if (garbageBytes >= MIN_COMPACT_BYTES && garbageBytes * 2 > bytesUsed) {
+        compact();
+    }
+}
+
+void ArenaArray::compact() {
+    if (garbageBytes == 0) {
+        return;
+    }
+    size_t liveBytes = bytesUsed - garbageBytes;
+    char* newBytes = new char[liveBytes > 0 ? liveBytes : 1];
+    size_t offset = 0;
+    for (size_t i = 0; i < currentSize; ++i) {
+        std::memcpy(newBytes + offset, bytes + slots[i].offset, slots[i].length);
+        slots[i].offset = static_cast<uint32_t>(offset);
+        offset += slots[i].length;
+    }
+    delete[] bytes;
+    bytes = newBytes;
+    bytesUsed = liveBytes;
+    bytesCapacity = liveBytes > 0 ? liveBytes : 1;
+    garbageBytes = 0;
+}
+
+void ArenaArray::insert(std::string_view value) {
+    insertAt(currentSize, value);
+}
+
+void ArenaArray::insertAt(size_t index, std::string_view value) {
+    if (index > currentSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    
+    // Сначала место под слот: если оно не выделится, байты не останутся
+    // в арене неучтенным мусором
+    if (currentSize >= capacity) {
+        resizeSlots((capacity == 0) ? 1 : capacity * 2);
+    }
+    Slot slot = appendBytes(value);
+    
+    std::memmove(slots + index + 1, slots + index, (currentSize - index) * sizeof(Slot));
+    slots[index] = slot;
+    currentSize++;
+}
+
+void ArenaArray::remove(size_t index) {
+    if (index >= currentSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    
+    garbageBytes += slots[index].length;
+    std::memmove(slots + index, slots + index + 1, (currentSize - index - 1) * sizeof(Slot));
+    currentSize--;
+    compactIfWasteful();
+}
+
+std::string ArenaArray::get(size_t index) const {
+    return std::string(view(index));
+}
+
+std::string_view ArenaArray::view(size_t index) const {
+    if (index >= currentSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    return std::string_view(bytes + slots[index].offset, slots[index].length);
+}
+
+void ArenaArray::set(size_t index, std::string_view value) {
+    if (index >= currentSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    
+    Slot& slot = slots[index];
+    if (value.size() <= slot.length) {
+        // Новое значение помещается на старое место
+        if (!value.empty()) {
+            std::memmove(bytes + slot.offset, value.data(), value.size());
+        }
+        garbageBytes += slot.length - value.size();
+        slot.length = static_cast<uint32_t>(value.size());
+    } else {
+        Slot newSlot = appendBytes(value);
+        garbageBytes += slots[index].length;
+        slots[index] = newSlot;
+    }
+    compactIfWasteful();
+}
+
+size_t ArenaArray::size() const {
+    return currentSize;
+}
+
+bool ArenaArray::empty() const {
+    return currentSize == 0;
+}
+
+size_t ArenaArray::memoryUsage() const {
+    return sizeof(ArenaArray) + bytesCapacity + capacity * sizeof(Slot);
+}
+
+void ArenaArray::clear() {
+    currentSize = 0;
+    bytesUsed = 0;
+    garbageBytes = 0;
+}
+
+void ArenaArray::print() const {
+    std::cout << "[";
+    for (size_t i = 0; i < currentSize; ++i) {
+        std::cout << "\"" << view(i) << "\"";
+        if (i < currentSize - 1) std::cout << ", ";
+    }
+    std::cout << "]" << std::endl;
+}
+
+void ArenaArray::serialize(std::ostream& os) const {
+    os.write(reinterpret_cast<const char*>(&currentSize), sizeof(currentSize));
+    
+    // Собираем длины и данные в общий буфер, чтобы не дергать поток на каждый элемент
+    std::string buffer;
+    buffer.reserve(SERIALIZE_BUFFER_BYTES);
+    for (size_t i = 0; i < currentSize; ++i) {
+        size_t strLen = slots[i].length;
+        if (buffer.size() + sizeof(strLen) + strLen > SERIALIZE_BUFFER_BYTES && !buffer.empty()) {
+            os.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+        buffer.append(reinterpret_cast<const char*>(&strLen), sizeof(strLen));
+        buffer.append(bytes + slots[i].offset, strLen);
+    }
+    os.write(buffer.data(), buffer.size());
+}
+
+void ArenaArray::deserialize(std::istream& is) {
+    size_t arrSize;
+    is.read(reinterpret_cast<char*>(&arrSize), sizeof(arrSize));
+    
+    clear();
+    resizeSlots(arrSize);
+    for (size_t i = 0; i < arrSize; ++i) {
+        size_t strLen;
+        is.read(reinterpret_cast<char*>(&strLen), sizeof(strLen));
+        reserveBytes(strLen);
+        is.read(bytes + bytesUsed, strLen);
+        slots[i] = Slot{static_cast<uint32_t>(bytesUsed), static_cast<uint32_t>(strLen)};
+        bytesUsed += strLen;
+    }
+    currentSize = arrSize;
+}
+
+// Текстовая сериализация
+void ArenaArray::serializeText(std::ostream& os) const {
+    os << currentSize << "\n";
+    for (size_t i = 0; i < currentSize; ++i) {
+        // Экранируем специальные символы
+        std::string escaped(view(i));
+        size_t pos = 0;
+        while ((pos = escaped.find('\n', pos)) != std::string::npos) {
+            escaped.replace(pos, 1, "\\n");
+            pos += 2;
+        }
+        pos = 0;
+        while ((pos = escaped.find('\"', pos)) != std::string::npos) {
+            escaped.replace(pos, 1, "\\\"");
+            pos += 2;
+        }
+        os << "\"" << escaped << "\"\n";
+    }
+}
+
+// Текстовая десериализация
+void ArenaArray::deserializeText(std::istream& is) {
+    size_t newSize;
+    is >> newSize;
+    is.get(); // Пропускаем перевод строки
+    
+    clear();
+    resizeSlots(newSize);
+    
+    for (size_t i = 0; i < newSize; ++i) {
+        std::string line;
+        std::getline(is, line);
+        
+        // Убираем обрамляющие кавычки и разэкранируем
+        if (line.size() >= 2 && line.front() == '\"' && line.back() == '\"') {
+            line = line.substr(1, line.size() - 2);
+            
+            size_t pos = 0;
+            while ((pos = line.find("\\n", pos)) != std::string::npos) {
+                line.replace(pos, 2, "\n");
+                pos += 1;
+            }
+            pos = 0;
+            while ((pos = line.find("\\\"", pos)) != std::string::npos) {
+                line.replace(pos, 2, "\"");
+                pos += 1;
+            }
+        }
+        
+        insert(line);
+    }
+}
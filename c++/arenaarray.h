@@ -0,0 +1,72 @@
+#ifndef ARENAARRAY_H
+#define ARENAARRAY_H
+
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+// Массив строк с общим байтовым буфером: все значения лежат подряд в одной
+// арене, а элемент хранит только смещение и длину (8 байт на элемент).
+// Интерфейс совпадает с Array, формат сериализации тоже.
+class ArenaArray {
+private:
+    struct Slot {
+        uint32_t offset;
+        uint32_t length;
+    };
+    
+    static const size_t MAX_ARENA_BYTES = UINT32_MAX;
+    static const size_t MIN_COMPACT_BYTES = 4096;
+    static const size_t SERIALIZE_BUFFER_BYTES = 64 * 1024;
+    
+    char* bytes;
+    size_t bytesUsed;
+    size_t bytesCapacity;
+    size_t garbageBytes;   // Байты, на которые больше не ссылается ни один слот
+    
+    Slot* slots;
+    size_t capacity;
+    size_t currentSize;
+    
+    void resizeSlots(size_t newCapacity);
+    void reserveBytes(size_t additional);
+    Slot appendBytes(std::string_view value);
+    void compactIfWasteful();
+
+public:
+    ArenaArray();
+    ArenaArray(const ArenaArray& other);
+    ArenaArray(ArenaArray&& other) noexcept;
+    ArenaArray& operator=(const ArenaArray& other);
+    ArenaArray& operator=(ArenaArray&& other) noexcept;
+    ~ArenaArray();
+    
+    void insert(std::string_view value);
+    void insertAt(size_t index, std::string_view value);
+    void remove(size_t index);
+    std::string get(size_t index) const;
+    // Представление действительно до следующего изменения массива
+    std::string_view view(size_t index) const;
+    void set(size_t index, std::string_view value);
+    size_t size() const;
+    bool empty() const;
+    
+    // Переупаковка арены без "дыр" от удаленных и замененных значений
+    void compact();
+    size_t memoryUsage() const;
+    
+    void clear();
+    void print() const;
+    
+    // Бинарная сериализация (совместима с Array)
+    void serialize(std::ostream& os) const;
+    void deserialize(std::istream& is);
+    
+    // Текстовая сериализация
+    void serializeText(std::ostream& os) const;
+    void deserializeText(std::istream& is);
+};
+
+#endif
@@ -1,115 +1,172 @@
 #include "array.h"
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <sstream>
+#include <string_view>
+#include <thread>
+#include <vector>
 
-Array::Array() : data(nullptr), capacity(0), currentSize(0) {}
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
 
-Array::Array(size_t size) : capacity(size), currentSize(size) {
-    data = new std::string[capacity];
-    for (size_t i = 0; i < currentSize; ++i) {
-        data[i] = "";
-    }
-}
-
-Array::Array(const Array& other) : capacity(other.capacity), currentSize(other.currentSize) {
-    data = new std::string[capacity];
-    for (size_t i = 0; i < currentSize; ++i) {
-        data[i] = other.data[i];
+template<>
+void Array<std::string>::radixSort(std::string* items, std::string* buffer, size_t count, size_t depth) {
+    auto bucket = [&depth](const std::string& value) -> size_t {
+        return depth < value.size() ? static_cast<unsigned char>(value[depth]) + 1 : 0;
+    };
+    
+    while (count >= RADIX_INSERTION_THRESHOLD) {
+        size_t counts[257] = {0};
+        for (size_t i = 0; i < count; ++i) {
+            counts[bucket(items[i])]++;
+        }
+        
+        // Общий префикс: все строки в одной корзине, переходим к следующему байту
+        if (counts[bucket(items[0])] == count) {
+            if (bucket(items[0]) == 0) {
+                return;
+            }
+            depth++;
+            continue;
+        }
+        
+        size_t offsets[257];
+        size_t sum = 0;
+        for (size_t b = 0; b < 257; ++b) {
+            offsets[b] = sum;
+            sum += counts[b];
+        }
+        for (size_t i = 0; i < count; ++i) {
+            buffer[offsets[bucket(items[i])]++] = std::move(items[i]);
+        }
+        std::move(buffer, buffer + count, items);
+        
+        // Корзина 0 - строки, закончившиеся на этой глубине, они равны между собой
+        size_t start = counts[0];
+        for (size_t b = 1; b < 257; ++b) {
+            if (counts[b] > 1) {
+                radixSort(items + start, buffer + start, counts[b], depth + 1);
+            }
+            start += counts[b];
+        }
+        return;
     }
-}
-
-Array& Array::operator=(const Array& other) {
-    if (this != &other) {
-        delete[] data;
-        capacity = other.capacity;
-        currentSize = other.currentSize;
-        data = new std::string[capacity];
-        for (size_t i = 0; i < currentSize; ++i) {
-            data[i] = other.data[i];
+    
+    // Маленькие корзины досортировываем вставками (стабильно)
+    for (size_t i = 1; i < count; ++i) {
+        if (!(items[i] < items[i - 1])) {
+            continue;
+        }
+        std::string value = std::move(items[i]);
+        size_t j = i;
+        while (j > 0 && value < items[j - 1]) {
+            items[j] = std::move(items[j - 1]);
+            --j;
         }
+        items[j] = std::move(value);
     }
-    return *this;
 }
 
-Array::~Array() {
-    delete[] data;
+template<>
+void Array<std::string>::sort(size_t threadCount) {
+    parallelSort([](std::string* items, std::string* buffer, size_t count) {
+        radixSort(items, buffer, count, 0);
+    }, std::less<std::string>(), threadCount);
 }
 
-void Array::resize(size_t newCapacity) {
-    std::string* newData = new std::string[newCapacity];
-    size_t copySize = (currentSize < newCapacity) ? currentSize : newCapacity;
-    for (size_t i = 0; i < copySize; ++i) {
-        newData[i] = data[i];
+template<>
+bool Array<std::string>::containsPattern(const std::string& text, const std::string& pattern) {
+    size_t n = text.size();
+    size_t m = pattern.size();
+    if (m == 0) {
+        return true;
     }
-    delete[] data;
-    data = newData;
-    capacity = newCapacity;
-    currentSize = copySize;
-}
-
-void Array::insert(const std::string& value) {
-    if (currentSize >= capacity) {
-        size_t newCapacity = (capacity == 0) ? 1 : capacity * 2;
-        resize(newCapacity);
-    }
-    data[currentSize++] = value;
-}
-
-void Array::insertAt(size_t index, const std::string& value) {
-    if (index > currentSize) {
-        throw std::out_of_range("Index out of range");
+    if (m > n) {
+        return false;
     }
     
-    if (currentSize >= capacity) {
-        size_t newCapacity = (capacity == 0) ? 1 : capacity * 2;
-        resize(newCapacity);
-    }
+    const char* s = text.data();
+    const char* p = pattern.data();
+    size_t starts = n - m + 1;  // Число возможных позиций начала
+    size_t i = 0;
+    
+    // Кандидат уже совпал по первому и последнему байту, сверяем середину
+    auto matchesAt = [s, p, m](size_t pos) {
+        return m <= 2 || std::memcmp(s + pos + 1, p + 1, m - 2) == 0;
+    };
+    auto checkMask = [&matchesAt](size_t base, uint32_t mask) {
+        while (mask != 0) {
+            if (matchesAt(base + __builtin_ctz(mask))) {
+                return true;
+            }
+            mask &= mask - 1;
+        }
+        return false;
+    };
     
-    for (size_t i = currentSize; i > index; --i) {
-        data[i] = data[i - 1];
+#if defined(__AVX2__)
+    const __m256i firstByte = _mm256_set1_epi8(p[0]);
+    const __m256i lastByte = _mm256_set1_epi8(p[m - 1]);
+    for (; i + 32 <= starts; i += 32) {
+        __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+        __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i + m - 1));
+        __m256i equal = _mm256_and_si256(_mm256_cmpeq_epi8(firstByte, blockFirst),
+                                         _mm256_cmpeq_epi8(lastByte, blockLast));
+        if (checkMask(i, static_cast<uint32_t>(_mm256_movemask_epi8(equal)))) {
+            return true;
+        }
     }
-    data[index] = value;
-    currentSize++;
-}
-
-void Array::remove(size_t index) {
-    if (index >= currentSize) {
-        throw std::out_of_range("Index out of range");
+#endif
+#if defined(__SSE2__)
+    const __m128i firstByte16 = _mm_set1_epi8(p[0]);
+    const __m128i lastByte16 = _mm_set1_epi8(p[m - 1]);
+    for (; i + 16 <= starts; i += 16) {
+        __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i + m - 1));
+        __m128i equal = _mm_and_si128(_mm_cmpeq_epi8(firstByte16, blockFirst),
+                                      _mm_cmpeq_epi8(lastByte16, blockLast));
+        if (checkMask(i, static_cast<uint32_t>(_mm_movemask_epi8(equal)))) {
+            return true;
+        }
     }
+#endif
     
-    for (size_t i = index; i < currentSize - 1; ++i) {
-        data[i] = data[i + 1];
+    // Хвост короче вектора (или платформа без SIMD)
+    for (; i < starts; ++i) {
+        if (s[i] == p[0] && s[i + m - 1] == p[m - 1] && matchesAt(i)) {
+            return true;
+        }
     }
-    currentSize--;
+    return false;
 }
 
-std::string Array::get(size_t index) const {
-    if (index >= currentSize) {
-        throw std::out_of_range("Index out of range");
+template<>
+std::vector<size_t> Array<std::string>::findAll(const std::string& pattern) const {
+    std::vector<size_t> result;
+    for (size_t i = 0; i < currentSize; ++i) {
+        if (containsPattern(data[i], pattern)) {
+            result.push_back(i);
+        }
     }
-    return data[index];
+    return result;
 }
 
-void Array::set(size_t index, const std::string& value) {
-    if (index >= currentSize) {
-        throw std::out_of_range("Index out of range");
+template<>
+std::vector<size_t> Array<std::string>::findPrefix(const std::string& prefix) const {
+    std::vector<size_t> result;
+    for (size_t i = 0; i < currentSize; ++i) {
+        const std::string& value = data[i];
+        if (value.size() >= prefix.size() && std::memcmp(value.data(), prefix.data(), prefix.size()) == 0) {
+            result.push_back(i);
+        }
     }
-    data[index] = value;
-}
-
-size_t Array::size() const {
-    return currentSize;
-}
-
-bool Array::empty() const {
-    return currentSize == 0;
+    return result;
 }
 
-void Array::clear() {
-    currentSize = 0;
-}
-
-void Array::print() const {
+template<>
+void Array<std::string>::print() const {
     std::cout << "[";
     for (size_t i = 0; i < currentSize; ++i) {
         std::cout << "\"" << data[i] << "\"";
@@ -118,7 +175,8 @@ void Array::print() const {
     std::cout << "]" << std::endl;
 }
 
-void Array::serialize(std::ostream& os) const {
+template<>
+void Array<std::string>::serialize(std::ostream& os) const {
     os.write(reinterpret_cast<const char*>(&currentSize), sizeof(currentSize));
     for (size_t i = 0; i < currentSize; ++i) {
         size_t strLen = data[i].length();
@@ -127,28 +185,26 @@ void Array::serialize(std::ostream& os) const {
     }
 }
 
-void Array::deserialize(std::istream& is) {
+template<>
+void Array<std::string>::deserialize(std::istream& is) {
     size_t arrSize;
     is.read(reinterpret_cast<char*>(&arrSize), sizeof(arrSize));
     
-    if (arrSize > capacity) {
-        delete[] data;
-        capacity = arrSize;
-        data = new std::string[capacity];
-    }
+    clear();
+    reserve(arrSize);
     
     currentSize = arrSize;
     for (size_t i = 0; i < arrSize; ++i) {
         size_t strLen;
         is.read(reinterpret_cast<char*>(&strLen), sizeof(strLen));
-        std::string value(strLen, ' ');
-        is.read(&value[0], strLen);
-        data[i] = value;
+        data[i].resize(strLen);
+        is.read(&data[i][0], strLen);
     }
 }
 
 // Текстовая сериализация
-void Array::serializeText(std::ostream& os) const {
+template<>
+void Array<std::string>::serializeText(std::ostream& os) const {
     os << currentSize << "\n";
     for (size_t i = 0; i < currentSize; ++i) {
         // Экранируем специальные символы
@@ -168,12 +224,14 @@ void Array::serializeText(std::ostream& os) const {
 }
 
 // Текстовая десериализация
-void Array::deserializeText(std::istream& is) {
+template<>
+void Array<std::string>::deserializeText(std::istream& is) {
     size_t newSize;
     is >> newSize;
     is.get(); // Пропускаем перевод строки
     
     clear();
+    reserve(newSize);
     
     for (size_t i = 0; i < newSize; ++i) {
         std::string line;
@@ -196,6 +254,8 @@ void Array::deserializeText(std::istream& is) {
             }
         }
         
-        insert(line);
+        insert(std::move(line));
     }
 }
+
+template class Array<std::string>;
@@ -1,37 +1,157 @@
 #ifndef ARRAY_H
 #define ARRAY_H
 
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <new>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
+// Динамический массив элементов типа T (по умолчанию - строки).
+// Для тривиально копируемых T память растет через realloc, а бинарная
+// сериализация пишет и читает все элементы одним блоком.
+template<typename T = std::string>
 class Array {
+public:
+    using Comparator = std::function<bool(const T&, const T&)>;
+
 private:
-    std::string* data;
+    // Сортирует отрезок items[0..count), buffer - рабочая память того же размера
+    using RunSorter = std::function<void(T* items, T* buffer, size_t count)>;
+    
+    static constexpr bool TRIVIALLY_COPYABLE = std::is_trivially_copyable<T>::value;
+    static const size_t MIN_PARALLEL_SORT_RUN = 16384;
+    static const size_t RADIX_INSERTION_THRESHOLD = 32;
+    
+    T* data;
     size_t capacity;
     size_t currentSize;
     
+    static T* allocate(size_t count);
+    static void deallocate(T* items);
+    
     void resize(size_t newCapacity);
+    void growIfFull();
+    // Освобождает count позиций начиная с index (одним сдвигом вправо)
+    // и возвращает указатель на первую из них
+    T* openSlots(size_t index, size_t count);
+    T& openSlot(size_t index);
+    
+    template<typename... Args>
+    static void assignValue(T& slot, Args&&... args) {
+        if constexpr (std::is_same<T, std::string>::value) {
+            slot.assign(std::forward<Args>(args)...);
+        } else {
+            slot = T(std::forward<Args>(args)...);
+        }
+    }
+    
+    static size_t sortThreads(size_t count, size_t requested);
+    void parallelSort(const RunSorter& sortRun, const Comparator& comp, size_t threadCount);
 
 public:
     Array();
     explicit Array(size_t size);
     Array(const Array& other);
+    Array(Array&& other) noexcept;
     Array& operator=(const Array& other);
+    Array& operator=(Array&& other) noexcept;
     ~Array();
     
-    void insert(const std::string& value);
-    void insertAt(size_t index, const std::string& value);
+    void insert(const T& value);
+    void insert(T&& value);
+    void insertAt(size_t index, const T& value);
+    void insertAt(size_t index, T&& value);
     void remove(size_t index);
-    std::string get(size_t index) const;
-    void set(size_t index, const std::string& value);
+    // Извлекает последний элемент перемещением, O(1)
+    T popBack();
+    T get(size_t index) const;
+    // Доступ без копирования элемента
+    const T& at(size_t index) const;
+    void set(size_t index, const T& value);
+    void set(size_t index, T&& value);
+    
+    // Конструирование элемента прямо в массиве
+    template<typename... Args>
+    void emplace(Args&&... args) {
+        growIfFull();
+        assignValue(data[currentSize++], std::forward<Args>(args)...);
+    }
+    
+    template<typename... Args>
+    void emplaceAt(size_t index, Args&&... args) {
+        assignValue(openSlot(index), std::forward<Args>(args)...);
+    }
+    
+    // Пакетные операции: один сдвиг на весь диапазон
+    template<typename ForwardIt>
+    void insertRange(size_t index, ForwardIt first, ForwardIt last) {
+        size_t count = static_cast<size_t>(std::distance(first, last));
+        T* slot = openSlots(index, count);
+        for (; first != last; ++first) {
+            *slot++ = *first;
+        }
+    }
+    
+    void removeRange(size_t begin, size_t end);
+    
+    // Удаляет все элементы, для которых pred вернул true, за один проход
+    template<typename Predicate>
+    size_t removeIf(Predicate pred) {
+        size_t kept = 0;
+        for (size_t i = 0; i < currentSize; ++i) {
+            if (!pred(static_cast<const T&>(data[i]))) {
+                if (kept != i) {
+                    data[kept] = std::move(data[i]);
+                }
+                kept++;
+            }
+        }
+        size_t removed = currentSize - kept;
+        currentSize = kept;
+        return removed;
+    }
+    
+    // Многопоточная сортировка на месте: каждый поток сортирует свой отрезок,
+    // затем отрезки попарно сливаются, каждое слияние тоже делится между потоками.
+    // threadCount = 0 - по числу ядер. sort() - стабильная сортировка по
+    // возрастанию (для строк - MSD radix по байтам), sort(comp) - нестабильная,
+    // stableSort(comp) - стабильная.
+    void sort(size_t threadCount = 0);
+    void sort(const Comparator& comp, size_t threadCount = 0);
+    void stableSort(const Comparator& comp, size_t threadCount = 0);
+    
+    // Только для строк: индексы элементов, содержащих pattern / начинающихся
+    // с prefix. Подстрока ищется векторно (AVX2 или SSE2, иначе скалярно):
+    // сначала отбираются позиции, где совпадают первый и последний байт образца.
+    std::vector<size_t> findAll(const std::string& pattern) const;
+    std::vector<size_t> findPrefix(const std::string& prefix) const;
+    
+    // Только для строк: однопоточные основы sort() и findAll() над непрерывным
+    // отрезком, ими же сортирует и ищет SmallArray. buffer - рабочая память
+    // на count строк, depth - с какого байта сравнивать (обычно 0).
+    static void radixSort(std::string* items, std::string* buffer, size_t count, size_t depth);
+    static bool containsPattern(const std::string& text, const std::string& pattern);
+    
+    void reserve(size_t newCapacity);
+    void shrinkToFit();
+    size_t getCapacity() const;
+    
     size_t size() const;
     bool empty() const;
     
     void clear();
     void print() const;
     
-    // Бинарная сериализация
+    // Бинарная сериализация: для строк - длина и байты каждого элемента,
+    // для тривиально копируемых T - один блок
     void serialize(std::ostream& os) const;
     void deserialize(std::istream& is);
     
@@ -40,4 +160,473 @@ public:
     void deserializeText(std::istream& is);
 };
 
+template<typename T>
+Array<T>::Array() : data(nullptr), capacity(0), currentSize(0) {}
+
+template<typename T>
+Array<T>::Array(size_t size) : data(allocate(size)), capacity(size), currentSize(size) {
+    std::fill(data, data + currentSize, T());
+}
+
+template<typename T>
+Array<T>::Array(const Array& other)
+    : data(allocate(other.capacity)), capacity(other.capacity), currentSize(other.currentSize) {
+    std::copy(other.data, other.data + currentSize, data);
+}
+
+template<typename T>
+Array<T>::Array(Array&& other) noexcept
+    : data(other.data), capacity(other.capacity), currentSize(other.currentSize) {
+    other.data = nullptr;
+    other.capacity = 0;
+    other.currentSize = 0;
+}
+
+template<typename T>
+Array<T>& Array<T>::operator=(const Array& other) {
+    if (this != &other) {
+        T* newData = allocate(other.capacity);
+        std::copy(other.data, other.data + other.currentSize, newData);
+        deallocate(data);
+        data = newData;
+        capacity = other.capacity;
+        currentSize = other.currentSize;
+    }
+    return *this;
+}
+
+template<typename T>
+Array<T>& Array<T>::operator=(Array&& other) noexcept {
+    if (this != &other) {
+        deallocate(data);
+        data = other.data;
+        capacity = other.capacity;
+        currentSize = other.currentSize;
+        other.data = nullptr;
+        other.capacity = 0;
+        other.currentSize = 0;
+    }
+    return *this;
+}
+
+template<typename T>
+Array<T>::~Array() {
+    deallocate(data);
+}
+
+template<typename T>
+T* Array<T>::allocate(size_t count) {
+    if (count == 0) {
+        return nullptr;
+    }
+    if constexpr (TRIVIALLY_COPYABLE) {
+        void* memory = std::malloc(count * sizeof(T));
+        if (memory == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(memory);
+    } else {
+        return new T[count];
+    }
+}
+
+template<typename T>
+void Array<T>::deallocate(T* items) {
+    if constexpr (TRIVIALLY_COPYABLE) {
+        std::free(items);
+    } else {
+        delete[] items;
+    }
+}
+
+template<typename T>
+void Array<T>::resize(size_t newCapacity) {
+    size_t copySize = (currentSize < newCapacity) ? currentSize : newCapacity;
+    if constexpr (TRIVIALLY_COPYABLE) {
+        // Тривиальные элементы переносятся побайтно, realloc может расширить блок на месте
+        if (newCapacity == 0) {
+            std::free(data);
+            data = nullptr;
+        } else {
+            void* memory = std::realloc(data, newCapacity * sizeof(T));
+            if (memory == nullptr) {
+                throw std::bad_alloc();
+            }
+            data = static_cast<T*>(memory);
+        }
+    } else {
+        T* newData = allocate(newCapacity);
+        for (size_t i = 0; i < copySize; ++i) {
+            newData[i] = std::move(data[i]);
+        }
+        deallocate(data);
+        data = newData;
+    }
+    capacity = newCapacity;
+    currentSize = copySize;
+}
+
+template<typename T>
+void Array<T>::growIfFull() {
+    if (currentSize >= capacity) {
+        size_t newCapacity = (capacity == 0) ? 1 : capacity * 2;
+        resize(newCapacity);
+    }
+}
+
+template<typename T>
+T* Array<T>::openSlots(size_t index, size_t count) {
+    if (index > currentSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    
+    if (currentSize + count > capacity) {
+        size_t doubled = (capacity == 0) ? 1 : capacity * 2;
+        resize(std::max(doubled, currentSize + count));
+    }
+    
+    std::move_backward(data + index, data + currentSize, data + currentSize + count);
+    currentSize += count;
+    return data + index;
+}
+
+template<typename T>
+T& Array<T>::openSlot(size_t index) {
+    return *openSlots(index, 1);
+}
+
+template<typename T>
+void Array<T>::insert(const T& value) {
+    growIfFull();
+    data[currentSize++] = value;
+}
+
+template<typename T>
+void Array<T>::insert(T&& value) {
+    growIfFull();
+    data[currentSize++] = std::move(value);
+}
+
+template<typename T>
+void Array<T>::insertAt(size_t index, const T& value) {
+    openSlot(index) = value;
+}
+
+template<typename T>
+void Array<T>::insertAt(size_t index, T&& value) {
+    openSlot(index) = std::move(value);
+}
+
+template<typename T>
+void Array<T>::remove(size_t index) {
+    if (index >= currentSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    
+    std::move(data + index + 1, data + currentSize, data + index);
+    currentSize--;
+}
+
+template<typename T>
+T Array<T>::popBack() {
+    if (currentSize == 0) {
+        throw std::out_of_range("Index out of range");
+    }
+    return std::move(data[--currentSize]);
+}
+
+template<typename T>
+void Array<T>::removeRange(size_t begin, size_t end) {
+    if (begin > end || end > currentSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    
+    std::move(data + end, data + currentSize, data + begin);
+    currentSize -= end - begin;
+}
+
+template<typename T>
+size_t Array<T>::sortThreads(size_t count, size_t requested) {
+    if (requested == 0) {
+        size_t hardware = std::thread::hardware_concurrency();
+        requested = std::min<size_t>(hardware, count / MIN_PARALLEL_SORT_RUN);
+    }
+    return std::max<size_t>(1, std::min(requested, count));
+}
+
+template<typename T>
+void Array<T>::parallelSort(const RunSorter& sortRun, const Comparator& comp, size_t threadCount) {
+    size_t n = currentSize;
+    if (n < 2) {
+        return;
+    }
+    
+    size_t threads = sortThreads(n, threadCount);
+    T* buffer = allocate(capacity);
+    
+    auto runTasks = [](std::vector<std::function<void()>>& tasks) {
+        std::vector<std::thread> workers;
+        for (size_t i = 1; i < tasks.size(); ++i) {
+            workers.emplace_back(tasks[i]);
+        }
+        if (!tasks.empty()) {
+            tasks[0]();
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    };
+    
+    // Этап 1: каждый поток сортирует свой отрезок
+    std::vector<size_t> bounds(threads + 1);
+    for (size_t t = 0; t <= threads; ++t) {
+        bounds[t] = n * t / threads;
+    }
+    std::vector<std::function<void()>> tasks;
+    for (size_t t = 0; t < threads; ++t) {
+        size_t begin = bounds[t];
+        size_t count = bounds[t + 1] - begin;
+        tasks.push_back([this, buffer, begin, count, &sortRun]() {
+            sortRun(data + begin, buffer + begin, count);
+        });
+    }
+    runTasks(tasks);
+    
+    // Этап 2: попарное слияние отрезков между data и buffer
+    T* src = data;
+    T* dst = buffer;
+    while (bounds.size() > 2) {
+        size_t runs = bounds.size() - 1;
+        size_t piecesPerPair = std::max<size_t>(1, threads / (runs / 2));
+        std::vector<size_t> merged;
+        tasks.clear();
+        
+        for (size_t r = 0; r < runs; r += 2) {
+            size_t lo = bounds[r];
+            merged.push_back(lo);
+            if (r + 1 == runs) {
+                size_t hi = bounds[r + 1];
+                tasks.push_back([src, dst, lo, hi]() {
+                    std::move(src + lo, src + hi, dst + lo);
+                });
+                continue;
+            }
+            
+            // Делим слияние на части: границы берутся в левом отрезке, парные
+            // им позиции в правом ищутся lower_bound, что сохраняет стабильность
+            size_t mid = bounds[r + 1];
+            size_t hi = bounds[r + 2];
+            std::vector<size_t> leftCuts(piecesPerPair + 1);
+            std::vector<size_t> rightCuts(piecesPerPair + 1);
+            for (size_t p = 0; p <= piecesPerPair; ++p) {
+                leftCuts[p] = lo + (mid - lo) * p / piecesPerPair;
+                if (p == 0) {
+                    rightCuts[p] = mid;
+                } else if (p == piecesPerPair) {
+                    rightCuts[p] = hi;
+                } else {
+                    rightCuts[p] = std::lower_bound(src + mid, src + hi, src[leftCuts[p]], comp) - src;
+                }
+            }
+            for (size_t p = 0; p < piecesPerPair; ++p) {
+                size_t leftBegin = leftCuts[p];
+                size_t leftEnd = leftCuts[p + 1];
+                size_t rightBegin = rightCuts[p];
+                size_t rightEnd = rightCuts[p + 1];
+                size_t out = leftBegin + (rightBegin - mid);
+                tasks.push_back([src, dst, leftBegin, leftEnd, rightBegin, rightEnd, out, &comp]() {
+                    std::merge(std::make_move_iterator(src + leftBegin), std::make_move_iterator(src + leftEnd),
+                               std::make_move_iterator(src + rightBegin), std::make_move_iterator(src + rightEnd),
+                               dst + out, comp);
+                });
+            }
+        }
+        merged.push_back(n);
+        runTasks(tasks);
+        
+        bounds = merged;
+        std::swap(src, dst);
+    }
+    
+    // Буфер выделен на всю емкость, поэтому результат можно просто забрать
+    if (src != data) {
+        std::swap(data, buffer);
+    }
+    deallocate(buffer);
+}
+
+template<typename T>
+void Array<T>::sort(size_t threadCount) {
+    std::less<T> less;
+    parallelSort([less](T* items, T*, size_t count) {
+        std::stable_sort(items, items + count, less);
+    }, less, threadCount);
+}
+
+template<typename T>
+void Array<T>::sort(const Comparator& comp, size_t threadCount) {
+    parallelSort([&comp](T* items, T*, size_t count) {
+        std::sort(items, items + count, comp);
+    }, comp, threadCount);
+}
+
+template<typename T>
+void Array<T>::stableSort(const Comparator& comp, size_t threadCount) {
+    parallelSort([&comp](T* items, T*, size_t count) {
+        std::stable_sort(items, items + count, comp);
+    }, comp, threadCount);
+}
+
+template<typename T>
+std::vector<size_t> Array<T>::findAll(const std::string&) const {
+    static_assert(std::is_same<T, std::string>::value, "findAll requires Array<std::string>");
+    return std::vector<size_t>();
+}
+
+template<typename T>
+std::vector<size_t> Array<T>::findPrefix(const std::string&) const {
+    static_assert(std::is_same<T, std::string>::value, "findPrefix requires Array<std::string>");
+    return std::vector<size_t>();
+}
+
+template<typename T>
+void Array<T>::reserve(size_t newCapacity) {
+    if (newCapacity > capacity) {
+        resize(newCapacity);
+    }
+}
+
+template<typename T>
+void Array<T>::shrinkToFit() {
+    if (capacity == currentSize) {
+        return;
+    }
+    if (currentSize == 0) {
+        deallocate(data);
+        data = nullptr;
+        capacity = 0;
+    } else {
+        resize(currentSize);
+    }
+}
+
+template<typename T>
+size_t Array<T>::getCapacity() const {
+    return capacity;
+}
+
+template<typename T>
+T Array<T>::get(size_t index) const {
+    if (index >= currentSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    return data[index];
+}
+
+template<typename T>
+const T& Array<T>::at(size_t index) const {
+    if (index >= currentSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    return data[index];
+}
+
+template<typename T>
+void Array<T>::set(size_t index, const T& value) {
+    if (index >= currentSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    data[index] = value;
+}
+
+template<typename T>
+void Array<T>::set(size_t index, T&& value) {
+    if (index >= currentSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    data[index] = std::move(value);
+}
+
+template<typename T>
+size_t Array<T>::size() const {
+    return currentSize;
+}
+
+template<typename T>
+bool Array<T>::empty() const {
+    return currentSize == 0;
+}
+
+template<typename T>
+void Array<T>::clear() {
+    currentSize = 0;
+}
+
+template<typename T>
+void Array<T>::print() const {
+    std::cout << "[";
+    for (size_t i = 0; i < currentSize; ++i) {
+        std::cout << data[i];
+        if (i < currentSize - 1) std::cout << ", ";
+    }
+    std::cout << "]" << std::endl;
+}
+
+template<typename T>
+void Array<T>::serialize(std::ostream& os) const {
+    static_assert(TRIVIALLY_COPYABLE, "binary serialization requires a trivially copyable T");
+    os.write(reinterpret_cast<const char*>(&currentSize), sizeof(currentSize));
+    os.write(reinterpret_cast<const char*>(data), currentSize * sizeof(T));
+}
+
+template<typename T>
+void Array<T>::deserialize(std::istream& is) {
+    static_assert(TRIVIALLY_COPYABLE, "binary serialization requires a trivially copyable T");
+    size_t arrSize = 0;
+    is.read(reinterpret_cast<char*>(&arrSize), sizeof(arrSize));
+    
+    clear();
+    reserve(arrSize);
+    is.read(reinterpret_cast<char*>(data), arrSize * sizeof(T));
+    currentSize = arrSize;
+}
+
+// Текстовая сериализация: количество и по одному элементу в строке
+template<typename T>
+void Array<T>::serializeText(std::ostream& os) const {
+    os << currentSize << "\n";
+    for (size_t i = 0; i < currentSize; ++i) {
+        os << data[i] << "\n";
+    }
+}
+
+template<typename T>
+void Array<T>::deserializeText(std::istream& is) {
+    size_t newSize;
+    is >> newSize;
+    
+    clear();
+    reserve(newSize);
+    
+    for (size_t i = 0; i < newSize; ++i) {
+        T value;
+        is >> value;
+        insert(std::move(value));
+    }
+}
+
+// Строковые версии определены в array.cpp
+template<> void Array<std::string>::radixSort(std::string* items, std::string* buffer, size_t count, size_t depth);
+template<> bool Array<std::string>::containsPattern(const std::string& text, const std::string& pattern);
+template<> void Array<std::string>::sort(size_t threadCount);
+template<> std::vector<size_t> Array<std::string>::findAll(const std::string& pattern) const;
+template<> std::vector<size_t> Array<std::string>::findPrefix(const std::string& prefix) const;
+template<> void Array<std::string>::print() const;
+template<> void Array<std::string>::serialize(std::ostream& os) const;
+template<> void Array<std::string>::deserialize(std::istream& is);
+template<> void Array<std::string>::serializeText(std::ostream& os) const;
+template<> void Array<std::string>::deserializeText(std::istream& is);
+
+extern template class Array<std::string>;
+
 #endif
@@ -3,13 +3,40 @@
 #include <vector>
 #include <string>
 #include <random>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <sstream>
+#include <thread>
+#include <mutex>
+#include <memory>
+#include <algorithm>
+#include <functional>
+#include <cstdio>
+#include <ctime>
 #include "array.h"
+#include "arenaarray.h"
+#include "tieredarray.h"
+#include "sortedarray.h"
+#include "cowarray.h"
+#include "mappedarray.h"
+#include "smallarray.h"
 #include "singlylinkedlist.h"
 #include "doublylinkedlist.h"
+#include "unrolledlist.h"
+#include "indexedlist.h"
+#include "intrusivelist.h"
+#include "compactlist.h"
 #include "queue.h"
+#include "mpmcqueue.h"
+#include "blockingqueue.h"
 #include "stack.h"
+#include "concurrentstack.h"
+#include "workstealingdeque.h"
 #include "hashtable.h"
 #include "tree.h"
+#include "serializationutils.h"
+#include "alloccounter.h"
 
 using namespace std;
 using namespace std::chrono;
@@ -73,6 +100,868 @@ public:
             }
         });
         cout << "Remove all elements: " << removeTime << " ms" << endl;
+        
+        vector<string> batch;
+        for (int i = 0; i < operations; i++) {
+            batch.push_back(randomString());
+        }
+        long long insertRangeTime = measureTime([&]() {
+            arr.insertRange(0, batch.begin(), batch.end());
+            arr.insertRange(arr.size() / 2, batch.begin(), batch.end());
+        });
+        cout << "Insert 2 x " << operations << " elements (insertRange): " << insertRangeTime << " ms" << endl;
+        
+        long long removeIfTime = measureTime([&]() {
+            arr.removeIf([](const string& value) { return value[0] < 'a'; });
+        });
+        cout << "Filter elements (removeIf): " << removeIfTime << " ms" << endl;
+        
+        long long removeRangeTime = measureTime([&]() {
+            arr.removeRange(0, arr.size());
+        });
+        cout << "Remove all elements (removeRange): " << removeRangeTime << " ms" << endl;
+        cout << endl;
+    }
+
+    template<typename Func>
+    size_t countAllocations(Func&& func) {
+        size_t before = allocationCount();
+        func();
+        return allocationCount() - before;
+    }
+
+    void benchmarkArrayMoves(int operations = 10000) {
+        cout << " Array Move Benchmark (long strings) " << endl;
+        
+        vector<string> source;
+        source.reserve(operations);
+        for (int i = 0; i < operations; i++) {
+            source.push_back(randomString(64));
+        }
+        
+        // Прежняя схема роста: new[] и копирующее присваивание каждой строки
+        vector<string> legacyValues(source);
+        size_t legacyAllocs = 0;
+        long long legacyTime = measureTime([&]() {
+            legacyAllocs = countAllocations([&]() {
+                string* data = nullptr;
+                size_t capacity = 0;
+                size_t count = 0;
+                for (const auto& value : legacyValues) {
+                    if (count >= capacity) {
+                        size_t newCapacity = (capacity == 0) ? 1 : capacity * 2;
+                        string* newData = new string[newCapacity];
+                        for (size_t i = 0; i < count; ++i) {
+                            newData[i] = data[i];
+                        }
+                        delete[] data;
+                        data = newData;
+                        capacity = newCapacity;
+                    }
+                    data[count++] = value;
+                }
+                delete[] data;
+            });
+        });
+        cout << "Copy insert + copy resize: " << legacyTime << " ms, "
+             << legacyAllocs << " allocations" << endl;
+        
+        vector<string> copyValues(source);
+        size_t copyAllocs = 0;
+        long long copyTime = measureTime([&]() {
+            copyAllocs = countAllocations([&]() {
+                Array arr;
+                for (const auto& value : copyValues) {
+                    arr.insert(value);
+                }
+            });
+        });
+        cout << "Copy insert + move resize: " << copyTime << " ms, "
+             << copyAllocs << " allocations" << endl;
+        
+        vector<string> moveValues(source);
+        size_t moveAllocs = 0;
+        long long moveTime = measureTime([&]() {
+            moveAllocs = countAllocations([&]() {
+                Array arr;
+                for (auto& value : moveValues) {
+                    arr.insert(std::move(value));
+                }
+            });
+        });
+        cout << "Move insert + move resize: " << moveTime << " ms, "
+             << moveAllocs << " allocations" << endl;
+        cout << endl;
+    }
+    
+    void benchmarkArraySort(int operations = 10000) {
+        size_t count = static_cast<size_t>(operations) * 10;
+        cout << " Array Sort Benchmark (" << count << " strings, "
+             << thread::hardware_concurrency() << " cores) " << endl;
+        
+        vector<string> source;
+        source.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            source.push_back(randomString(16));
+        }
+        
+        auto fill = [&](Array<string>& arr) {
+            arr.clear();
+            arr.reserve(count);
+            for (const auto& value : source) {
+                arr.insert(value);
+            }
+        };
+        
+        vector<string> reference(source.begin(), source.end());
+        long long stdTime = measureTime([&]() {
+            std::sort(reference.begin(), reference.end());
+        });
+        cout << "std::sort (1 thread): " << stdTime << " ms" << endl;
+        
+        Array arr;
+        fill(arr);
+        long long radixSingle = measureTime([&]() {
+            arr.sort(1);
+        });
+        cout << "Array::sort radix (1 thread): " << radixSingle << " ms" << endl;
+        
+        fill(arr);
+        long long radixParallel = measureTime([&]() {
+            arr.sort();
+        });
+        cout << "Array::sort radix (auto threads): " << radixParallel << " ms" << endl;
+        
+        fill(arr);
+        long long compParallel = measureTime([&]() {
+            arr.sort(std::less<string>());
+        });
+        cout << "Array::sort comparator (auto threads): " << compParallel << " ms" << endl;
+        
+        fill(arr);
+        long long stableParallel = measureTime([&]() {
+            arr.stableSort(std::less<string>());
+        });
+        cout << "Array::stableSort (auto threads): " << stableParallel << " ms" << endl;
+        cout << endl;
+    }
+    
+    void benchmarkArrayFind(int operations = 10000) {
+        cout << " Array Find Benchmark (" << operations << " strings x 128 bytes) " << endl;
+        
+        Array arr;
+        for (int i = 0; i < operations; i++) {
+            arr.insert(randomString(128));
+        }
+        const string pattern = "needle";
+        arr.set(static_cast<size_t>(operations / 2), randomString(60) + pattern + randomString(62));
+        
+        size_t scalarFound = 0;
+        long long scalarTime = measureTime([&]() {
+            for (int repeat = 0; repeat < 10; repeat++) {
+                scalarFound = 0;
+                for (size_t i = 0; i < arr.size(); i++) {
+                    if (arr.at(i).find(pattern) != string::npos) {
+                        scalarFound++;
+                    }
+                }
+            }
+        });
+        cout << "std::string::find x10: " << scalarTime << " ms (" << scalarFound << " found)" << endl;
+        
+        size_t simdFound = 0;
+        long long simdTime = measureTime([&]() {
+            for (int repeat = 0; repeat < 10; repeat++) {
+                simdFound = arr.findAll(pattern).size();
+            }
+        });
+        cout << "Array::findAll x10: " << simdTime << " ms (" << simdFound << " found)" << endl;
+        
+        long long prefixTime = measureTime([&]() {
+            for (int repeat = 0; repeat < 10; repeat++) {
+                arr.findPrefix("ab");
+            }
+        });
+        cout << "Array::findPrefix x10: " << prefixTime << " ms" << endl;
+        cout << endl;
+    }
+
+    void benchmarkGenericArray(int operations = 10000) {
+        cout << " Generic Array Benchmark (int vs stringified int) " << endl;
+        
+        size_t count = static_cast<size_t>(operations) * 10;
+        size_t stringAllocs = 0;
+        stringstream stringStream;
+        long long stringTime = measureTime([&]() {
+            stringAllocs = countAllocations([&]() {
+                Array<string> arr;
+                for (size_t i = 0; i < count; i++) {
+                    arr.insert(to_string(i * 1000003));
+                }
+                arr.serialize(stringStream);
+            });
+        });
+        cout << "Array<string>: insert + serialize " << stringTime << " ms, "
+             << stringAllocs << " allocations, " << stringStream.str().size() << " bytes" << endl;
+        
+        size_t intAllocs = 0;
+        stringstream intStream;
+        long long intTime = measureTime([&]() {
+            intAllocs = countAllocations([&]() {
+                Array<long long> arr;
+                for (size_t i = 0; i < count; i++) {
+                    arr.insert(static_cast<long long>(i * 1000003));
+                }
+                arr.serialize(intStream);
+            });
+        });
+        cout << "Array<long long>: insert + serialize " << intTime << " ms, "
+             << intAllocs << " allocations, " << intStream.str().size() << " bytes" << endl;
+        
+        Array<long long> loaded;
+        long long loadTime = measureTime([&]() {
+            loaded.deserialize(intStream);
+        });
+        cout << "Array<long long>: deserialize " << loaded.size() << " elements: " << loadTime << " ms" << endl;
+        cout << endl;
+    }
+
+    template<typename Container>
+    void measureStringStorage(const string& name, const vector<string>& keys) {
+        stringstream ss;
+        size_t totalLength = 0;
+        size_t allocs = 0;
+        Container arr;
+        long long insertTime = measureTime([&]() {
+            allocs = countAllocations([&]() {
+                for (const auto& key : keys) {
+                    arr.insert(key);
+                }
+            });
+        });
+        long long scanTime = measureTime([&]() {
+            for (size_t i = 0; i < arr.size(); ++i) {
+                totalLength += arr.get(i).size();
+            }
+        });
+        long long serializeTime = measureTime([&]() {
+            arr.serialize(ss);
+        });
+        cout << name << ": insert " << insertTime << " ms (" << allocs << " allocations), scan "
+             << scanTime << " ms, serialize " << serializeTime << " ms, "
+             << ss.str().size() << " bytes, checksum " << totalLength << endl;
+    }
+
+    void benchmarkArenaArray(int operations = 10000) {
+        cout << " Arena Array Benchmark (short keys) " << endl;
+        
+        vector<string> keys;
+        keys.reserve(operations);
+        for (int i = 0; i < operations; i++) {
+            keys.push_back(randomString(24));
+        }
+        
+        measureStringStorage<Array<string>>("Array", keys);
+        measureStringStorage<ArenaArray>("ArenaArray", keys);
+        
+        ArenaArray arena;
+        for (const auto& key : keys) {
+            arena.insert(key);
+        }
+        cout << "ArenaArray memory: " << arena.memoryUsage() << " bytes ("
+             << arena.memoryUsage() / max<size_t>(arena.size(), 1) << " per element)" << endl;
+        cout << endl;
+    }
+
+    template<typename Container>
+    long long measurePositionalEdits(size_t initialSize, int edits) {
+        Container arr;
+        for (size_t i = 0; i < initialSize; i++) {
+            arr.insert(randomString());
+        }
+        return measureTime([&]() {
+            for (int i = 0; i < edits; i++) {
+                arr.insertAt(gen() % (arr.size() + 1), randomString());
+                arr.remove(gen() % arr.size());
+            }
+        });
+    }
+
+    void benchmarkTieredArray(int operations = 10000) {
+        cout << " Tiered Array Benchmark (random insertAt + remove) " << endl;
+        
+        const int edits = 1000;
+        for (size_t n = max(operations / 10, 1); n <= static_cast<size_t>(operations) * 10; n *= 10) {
+            long long flatTime = measurePositionalEdits<Array<string>>(n, edits);
+            long long tieredTime = measurePositionalEdits<TieredArray>(n, edits);
+            cout << "n = " << n << ": Array " << flatTime << " ms, TieredArray "
+                 << tieredTime << " ms (" << edits << " edit pairs)" << endl;
+        }
+        cout << endl;
+    }
+
+    void benchmarkSortedArray(int operations = 10000) {
+        cout << " Sorted Array Benchmark (lookup by value) " << endl;
+        
+        Array arr;
+        SortedArray sorted;
+        vector<string> keys;
+        for (int i = 0; i < operations; i++) {
+            keys.push_back(randomString());
+            arr.insert(keys.back());
+            sorted.insertSorted(keys.back());
+        }
+        
+        const int lookups = 1000;
+        size_t linearHits = 0;
+        long long linearTime = measureTime([&]() {
+            for (int i = 0; i < lookups; i++) {
+                const string& key = keys[gen() % keys.size()];
+                for (size_t j = 0; j < arr.size(); j++) {
+                    if (arr.get(j) == key) {
+                        linearHits++;
+                        break;
+                    }
+                }
+            }
+        });
+        size_t binaryHits = 0;
+        long long binaryTime = measureTime([&]() {
+            for (int i = 0; i < lookups; i++) {
+                binaryHits += sorted.contains(keys[gen() % keys.size()]) ? 1 : 0;
+            }
+        });
+        cout << lookups << " lookups: linear scan " << linearTime << " ms (" << linearHits
+             << " hits), binary search " << binaryTime << " ms (" << binaryHits << " hits)" << endl;
+        cout << endl;
+    }
+
+    void benchmarkCowArray(int operations = 10000) {
+        cout << " COW Array Benchmark (snapshot vs deep copy) " << endl;
+        
+        Array arr;
+        CowArray cow;
+        for (int i = 0; i < operations; i++) {
+            string value = randomString(32);
+            arr.insert(value);
+            cow.insert(value);
+        }
+        
+        const int snapshots = 100;
+        size_t copiedSize = 0;
+        long long copyTime = measureTime([&]() {
+            for (int i = 0; i < snapshots; i++) {
+                Array copy(arr);
+                copiedSize += copy.size();
+            }
+        });
+        cout << snapshots << " Array deep copies: " << copyTime << " ms" << endl;
+        
+        long long snapshotTime = measureTime([&]() {
+            for (int i = 0; i < snapshots; i++) {
+                CowArray snap = cow.snapshot();
+                copiedSize += snap.size();
+            }
+        });
+        cout << snapshots << " CowArray snapshots: " << snapshotTime << " ms" << endl;
+        
+        // Запись после снимка копирует только затронутые блоки
+        CowArray snap = cow.snapshot();
+        size_t writeAllocs = 0;
+        long long writeTime = measureTime([&]() {
+            writeAllocs = countAllocations([&]() {
+                for (int i = 0; i < 1000; i++) {
+                    cow.set(gen() % cow.size(), "updated");
+                }
+            });
+        });
+        cout << "1000 random writes after snapshot: " << writeTime << " ms, "
+             << writeAllocs << " allocations (checksum " << copiedSize + snap.size() << ")" << endl;
+        cout << endl;
+    }
+
+    void benchmarkMappedArray(int operations = 10000) {
+        size_t count = static_cast<size_t>(operations) * 10;
+        cout << " Mapped Array Benchmark (" << count << " strings) " << endl;
+        
+        Array<string> arr;
+        for (size_t i = 0; i < count; i++) {
+            arr.insert(randomString(32));
+        }
+        const string binaryFile = "benchmark_array.bin";
+        const string mappedFile = "benchmark_array.map";
+        SerializationUtils::saveToBinaryFile(arr, binaryFile);
+        SerializationUtils::saveToMappedFile(arr, mappedFile);
+        
+        Array<string> loaded;
+        long long loadTime = measureTime([&]() {
+            SerializationUtils::loadFromBinaryFile(loaded, binaryFile);
+        });
+        cout << "Array::deserialize: " << loadTime << " ms" << endl;
+        
+        MappedArray mapped;
+        long long openTime = measureTime([&]() {
+            mapped.open(mappedFile);
+        });
+        cout << "MappedArray::open (mapped layout): " << openTime << " ms" << endl;
+        
+        size_t totalBytes = 0;
+        long long readTime = measureTime([&]() {
+            for (size_t i = 0; i < mapped.size(); i++) {
+                totalBytes += mapped.get(i).size();
+            }
+        });
+        cout << "Read all views: " << readTime << " ms (" << totalBytes << " bytes)" << endl;
+        
+        MappedArray scanned;
+        long long scanTime = measureTime([&]() {
+            scanned.open(binaryFile);
+        });
+        cout << "MappedArray::open (Array binary, index scan): " << scanTime << " ms" << endl;
+        
+        mapped.close();
+        scanned.close();
+        remove(binaryFile.c_str());
+        remove(mappedFile.c_str());
+        cout << endl;
+    }
+
+    void benchmarkSmallArray(int operations = 10000) {
+        size_t arrays = static_cast<size_t>(operations) * 10;
+        cout << " Small Array Benchmark (" << arrays << " named arrays of 1-4 elements) " << endl;
+        
+        // Как в ConsoleInterface: каждый массив создается через new и хранится по указателю;
+        // Array - прежний тип консольных массивов, SmallArray - нынешний
+        size_t arrayAllocs = 0;
+        long long arrayTime = measureTime([&]() {
+            arrayAllocs = countAllocations([&]() {
+                vector<Array<string>*> named;
+                named.reserve(arrays);
+                for (size_t i = 0; i < arrays; i++) {
+                    Array<string>* arr = new Array<string>();
+                    for (size_t j = 0; j <= i % 4; j++) {
+                        arr->insert("v");
+                    }
+                    named.push_back(arr);
+                }
+                for (auto* arr : named) {
+                    delete arr;
+                }
+            });
+        });
+        cout << "Array<string>: " << arrayTime << " ms, " << arrayAllocs << " allocations" << endl;
+        
+        size_t smallAllocs = 0;
+        long long smallTime = measureTime([&]() {
+            smallAllocs = countAllocations([&]() {
+                vector<SmallArray<string, 4>*> named;
+                named.reserve(arrays);
+                for (size_t i = 0; i < arrays; i++) {
+                    SmallArray<string, 4>* arr = new SmallArray<string, 4>();
+                    for (size_t j = 0; j <= i % 4; j++) {
+                        arr->insert("v");
+                    }
+                    named.push_back(arr);
+                }
+                for (auto* arr : named) {
+                    delete arr;
+                }
+            });
+        });
+        cout << "SmallArray<string, 4>: " << smallTime << " ms, " << smallAllocs << " allocations" << endl;
+        cout << "Bytes per array object: Array " << sizeof(Array<string>)
+             << " + heap block, SmallArray " << sizeof(SmallArray<string, 4>) << endl;
+        cout << endl;
+    }
+
+    template<typename Func>
+    double measureNanosPerOp(size_t ops, Func&& func) {
+        auto start = high_resolution_clock::now();
+        func();
+        auto end = high_resolution_clock::now();
+        return static_cast<double>(duration_cast<nanoseconds>(end - start).count()) / ops;
+    }
+
+    template<typename List>
+    void measureListChurn(const string& name, size_t ops) {
+        List list;
+        const string value = "msg";
+        size_t allocs = 0;
+        double nanos = measureNanosPerOp(ops, [&]() {
+            allocs = countAllocations([&]() {
+                for (size_t i = 0; i < ops; i++) {
+                    list.push_back(value);
+                    if (i % 4 != 0) {
+                        list.pop_front();
+                    }
+                }
+                list.clear();
+            });
+        });
+        cout << name << ": " << nanos << " ns/op, "
+             << static_cast<double>(allocs) / ops << " allocations/op" << endl;
+    }
+
+    void benchmarkListNodePool(int operations = 10000) {
+        size_t ops = static_cast<size_t>(operations) * 50;
+        cout << " List Node Pool Benchmark (" << ops << " push_back + 3/4 pop_front) " << endl;
+        
+        // Прежняя схема: new/delete на каждый узел
+        struct LegacyNode {
+            string data;
+            LegacyNode* next;
+        };
+        const string value = "msg";
+        size_t legacyAllocs = 0;
+        double legacyNanos = measureNanosPerOp(ops, [&]() {
+            legacyAllocs = countAllocations([&]() {
+                LegacyNode* head = nullptr;
+                LegacyNode* tail = nullptr;
+                for (size_t i = 0; i < ops; i++) {
+                    LegacyNode* node = new LegacyNode{value, nullptr};
+                    if (tail != nullptr) {
+                        tail->next = node;
+                    } else {
+                        head = node;
+                    }
+                    tail = node;
+                    if (i % 4 != 0) {
+                        LegacyNode* old = head;
+                        head = head->next;
+                        if (head == nullptr) {
+                            tail = nullptr;
+                        }
+                        delete old;
+                    }
+                }
+                while (head != nullptr) {
+                    LegacyNode* old = head;
+                    head = head->next;
+                    delete old;
+                }
+            });
+        });
+        cout << "new/delete per node: " << legacyNanos << " ns/op, "
+             << static_cast<double>(legacyAllocs) / ops << " allocations/op" << endl;
+        
+        measureListChurn<SinglyLinkedList>("SinglyLinkedList (pool)", ops);
+        measureListChurn<DoublyLinkedList>("DoublyLinkedList (pool)", ops);
+        cout << endl;
+    }
+
+    template<typename List>
+    void measureListTraversal(const string& name, size_t count, const vector<size_t>& indices) {
+        List list;
+        for (size_t i = 0; i < count; i++) {
+            list.push_back("item" + to_string(i));
+        }
+        
+        size_t found = 0;
+        double getNanos = measureNanosPerOp(indices.size(), [&]() {
+            for (size_t index : indices) {
+                found += list.get(index).size();
+            }
+        });
+        long long scanTime = measureTime([&]() {
+            found += list.contains("missing") ? 1 : 0;
+        });
+        long long vectorTime = measureTime([&]() {
+            found += list.toVector().size();
+        });
+        long long serializeTime = measureTime([&]() {
+            stringstream ss;
+            list.serialize(ss);
+            found += ss.str().size();
+        });
+        cout << name << ": get " << getNanos / 1000000 << " ms/op, contains " << scanTime
+             << " ms, toVector " << vectorTime << " ms, serialize " << serializeTime
+             << " ms (checksum " << found << ")" << endl;
+    }
+
+    void benchmarkUnrolledList(int operations = 10000) {
+        size_t count = static_cast<size_t>(operations) * 50;
+        cout << " Unrolled List Benchmark (" << count << " elements, block "
+             << UnrolledList::BLOCK_CAPACITY << ") " << endl;
+        
+        mt19937 rng(15);
+        vector<size_t> indices(50);
+        for (size_t& index : indices) {
+            index = rng() % count;
+        }
+        
+        measureListTraversal<SinglyLinkedList>("SinglyLinkedList", count, indices);
+        measureListTraversal<DoublyLinkedList>("DoublyLinkedList", count, indices);
+        measureListTraversal<UnrolledList>("UnrolledList", count, indices);
+        cout << endl;
+    }
+
+    template<typename List>
+    void measureListIteration(const string& name, size_t count) {
+        List list;
+        for (size_t i = 0; i < count; i++) {
+            list.push_back("item" + to_string(i));
+        }
+        
+        size_t total = 0;
+        long long getTime = measureTime([&]() {
+            for (size_t i = 0; i < list.size(); i++) {
+                total += list.get(i).size();
+            }
+        });
+        long long iteratorTime = measureTime([&]() {
+            for (const string& value : list) {
+                total += value.size();
+            }
+        });
+        long long forEachTime = measureTime([&]() {
+            list.forEach([&](const string& value) { total += value.size(); });
+        });
+        cout << name << ": get(i) loop " << getTime << " ms, range-for " << iteratorTime
+             << " ms, forEach " << forEachTime << " ms (checksum " << total << ")" << endl;
+    }
+
+    void benchmarkListIteration(int operations = 10000) {
+        size_t count = static_cast<size_t>(operations) * 50;
+        cout << " List Iteration Benchmark (" << count << " elements) " << endl;
+        measureListIteration<SinglyLinkedList>("SinglyLinkedList", count);
+        measureListIteration<DoublyLinkedList>("DoublyLinkedList", count);
+        cout << endl;
+    }
+
+    template<typename List>
+    void measureMidListEdits(const string& name, size_t count, size_t edits) {
+        List list;
+        for (size_t i = 0; i < count; i++) {
+            list.push_back("item" + to_string(i));
+        }
+        
+        mt19937 rng(17);
+        size_t total = 0;
+        double insertNanos = measureNanosPerOp(edits, [&]() {
+            for (size_t i = 0; i < edits; i++) {
+                list.insert(rng() % list.size(), "new");
+            }
+        });
+        double getNanos = measureNanosPerOp(edits, [&]() {
+            for (size_t i = 0; i < edits; i++) {
+                total += list.get(rng() % list.size()).size();
+            }
+        });
+        double removeNanos = measureNanosPerOp(edits, [&]() {
+            for (size_t i = 0; i < edits; i++) {
+                list.remove(rng() % list.size());
+            }
+        });
+        double endNanos = measureNanosPerOp(edits * 100, [&]() {
+            for (size_t i = 0; i < edits * 100; i++) {
+                list.push_back("tail");
+                list.pop_front();
+            }
+        });
+        cout << name << ": insert " << insertNanos << " ns, get " << getNanos
+             << " ns, remove " << removeNanos << " ns, push_back+pop_front " << endNanos
+             << " ns (checksum " << total << ")" << endl;
+    }
+
+    void benchmarkIndexedList(int operations = 10000) {
+        size_t count = static_cast<size_t>(operations) * 50;
+        size_t edits = 200;
+        cout << " Indexed List Benchmark (" << count << " elements, " << edits
+             << " random positional ops each) " << endl;
+        measureMidListEdits<DoublyLinkedList>("DoublyLinkedList", count, edits);
+        measureMidListEdits<UnrolledList>("UnrolledList", count, edits);
+        measureMidListEdits<IndexedList>("IndexedList", count, edits);
+        cout << endl;
+    }
+
+    void benchmarkListSpliceSort(int operations = 10000) {
+        size_t count = static_cast<size_t>(operations) * 25;
+        cout << " List Splice/Sort Benchmark (" << count << " + " << count << " elements) " << endl;
+        
+        auto fill = [&](DoublyLinkedList& list) {
+            for (size_t i = 0; i < count; i++) {
+                list.push_back(randomString());
+            }
+        };
+        
+        // Прежний способ: через toVector и повторные push_back
+        DoublyLinkedList target;
+        DoublyLinkedList source;
+        fill(target);
+        fill(source);
+        size_t copyAllocs = 0;
+        long long copyTime = measureTime([&]() {
+            copyAllocs = countAllocations([&]() {
+                for (const string& value : source.toVector()) {
+                    target.push_back(value);
+                }
+                source.clear();
+            });
+        });
+        cout << "Concat via toVector + push_back: " << copyTime << " ms, " << copyAllocs << " allocations" << endl;
+        
+        DoublyLinkedList spliced;
+        source = DoublyLinkedList();
+        fill(spliced);
+        fill(source);
+        size_t spliceAllocs = 0;
+        long long spliceTime = measureTime([&]() {
+            spliceAllocs = countAllocations([&]() {
+                spliced.concat(source);
+            });
+        });
+        cout << "concat(): " << spliceTime << " ms, " << spliceAllocs << " allocations" << endl;
+        
+        vector<string> values = spliced.toVector();
+        size_t vectorAllocs = 0;
+        long long vectorTime = measureTime([&]() {
+            vectorAllocs = countAllocations([&]() {
+                vector<string> copy = spliced.toVector();
+                stable_sort(copy.begin(), copy.end());
+                DoublyLinkedList rebuilt;
+                for (const string& value : copy) {
+                    rebuilt.push_back(value);
+                }
+            });
+        });
+        cout << "Sort via toVector + stable_sort + rebuild: " << vectorTime << " ms, "
+             << vectorAllocs << " allocations" << endl;
+        
+        size_t sortAllocs = 0;
+        long long sortTime = measureTime([&]() {
+            sortAllocs = countAllocations([&]() {
+                spliced.sort();
+            });
+        });
+        cout << "sort() in place: " << sortTime << " ms, " << sortAllocs << " allocations" << endl;
+        cout << endl;
+    }
+
+    void benchmarkIntrusiveList(int operations = 10000) {
+        size_t ops = static_cast<size_t>(operations) * 50;
+        const size_t inFlight = 64;
+        cout << " Intrusive List Benchmark (" << ops << " push_back + pop_front, "
+             << inFlight << " in flight, 40-byte payloads) " << endl;
+        
+        // Объекты уже живут в пуле вызывающего кода
+        struct Message : ListHook<> {
+            string payload;
+        };
+        vector<Message> messages(inFlight * 2);
+        for (auto& message : messages) {
+            message.payload = randomString(40);
+        }
+        
+        size_t checksum = 0;
+        DoublyLinkedList copied;
+        size_t copiedAllocs = 0;
+        double copiedNanos = measureNanosPerOp(ops, [&]() {
+            copiedAllocs = countAllocations([&]() {
+                for (size_t i = 0; i < ops; i++) {
+                    copied.push_back(messages[i % messages.size()].payload);
+                    if (copied.size() > inFlight) {
+                        checksum += copied.begin()->size();
+                        copied.pop_front();
+                    }
+                }
+                copied.clear();
+            });
+        });
+        
+        IntrusiveDoublyList<Message> linked;
+        size_t linkedAllocs = 0;
+        double linkedNanos = measureNanosPerOp(ops, [&]() {
+            linkedAllocs = countAllocations([&]() {
+                for (size_t i = 0; i < ops; i++) {
+                    linked.push_back(messages[i % messages.size()]);
+                    if (linked.size() > inFlight) {
+                        checksum += linked.pop_front().payload.size();
+                    }
+                }
+                linked.clear();
+            });
+        });
+        
+        cout << "DoublyLinkedList (copy): " << copiedNanos << " ns/op, "
+             << static_cast<double>(copiedAllocs) / ops << " allocations/op" << endl;
+        cout << "IntrusiveDoublyList:     " << linkedNanos << " ns/op, "
+             << static_cast<double>(linkedAllocs) / ops << " allocations/op (checksum "
+             << checksum << ")" << endl;
+        cout << endl;
+    }
+
+    template<typename List>
+    void measureCompactCandidate(const string& name, List& list, size_t count) {
+        size_t allocs = countAllocations([&]() {
+            for (size_t i = 0; i < count; i++) {
+                if (i % 2 == 0) {
+                    list.push_back("item" + to_string(i));
+                } else {
+                    list.push_front("item" + to_string(i));
+                }
+            }
+        });
+        
+        size_t total = 0;
+        long long forEachTime = measureTime([&]() {
+            list.forEach([&](const string& value) { total += value.size(); });
+        });
+        stringstream ss;
+        long long serializeTime = measureTime([&]() {
+            list.serialize(ss);
+        });
+        long long deserializeTime = measureTime([&]() {
+            list.deserialize(ss);
+        });
+        cout << name << ": " << static_cast<double>(allocs) / count << " allocations/element, forEach "
+             << forEachTime << " ms, serialize " << serializeTime << " ms, deserialize "
+             << deserializeTime << " ms (checksum " << total << ")" << endl;
+    }
+
+    void benchmarkCompactList(int operations = 10000) {
+        size_t count = static_cast<size_t>(operations) * 50;
+        cout << " Compact List Benchmark (" << count << " elements, alternating ends) " << endl;
+        
+        DoublyLinkedList doubly;
+        measureCompactCandidate("DoublyLinkedList", doubly, count);
+        CompactList compact;
+        measureCompactCandidate("CompactList", compact, count);
+        
+        cout << "Links per element: DoublyLinkedList " << 2 * sizeof(void*) << " bytes, CompactList "
+             << 2 * sizeof(uint32_t) << " bytes (" << compact.memoryUsage() / count
+             << " bytes/element with the string slots)" << endl;
+        cout << endl;
+    }
+
+    void benchmarkListDedup(int operations = 10000) {
+        int records = max(1, operations / 2);
+        cout << "List Dedup Benchmark (" << records << " records, ~50% duplicates)" << endl;
+        
+        mt19937 rng(22);
+        vector<string> incoming;
+        for (int i = 0; i < records; i++) {
+            incoming.push_back("record-" + to_string(rng() % max(1, records / 2)));
+        }
+        
+        auto dedup = [&](SinglyLinkedList& list) {
+            return measureTime([&]() {
+                for (const auto& record : incoming) {
+                    if (!list.contains(record)) {
+                        list.push_back(record);
+                    }
+                }
+            });
+        };
+        
+        SinglyLinkedList scanned;
+        long long scanTime = dedup(scanned);
+        SinglyLinkedList indexed;
+        indexed.enableValueIndex();
+        long long indexTime = dedup(indexed);
+        
+        cout << "Linear contains: " << scanTime << " ms" << endl;
+        cout << "Value index:     " << indexTime << " ms (" << indexed.size() << " unique, index "
+             << indexed.valueIndexMemoryUsage() / 1024 << " KB)" << endl;
         cout << endl;
     }
 
@@ -147,6 +1036,178 @@ public:
             }
         });
         cout << "Dequeue all elements: " << dequeueTime << " ms" << endl;
+        
+        // Буферизация сообщений: пачки по 64 строки перемещаются туда и обратно
+        const size_t batch = 64;
+        size_t pairs = static_cast<size_t>(operations) * 50;
+        vector<string> inBuffer(batch, string(24, 'm'));
+        vector<string> outBuffer(batch);
+        size_t batchAllocs = 0;
+        long long batchTime = measureTime([&]() {
+            batchAllocs = countAllocations([&]() {
+                for (size_t done = 0; done < pairs; done += batch) {
+                    q.enqueueBatch(inBuffer.begin(), inBuffer.end());
+                    q.dequeueBatch(outBuffer.begin(), batch);
+                    inBuffer.swap(outBuffer);
+                }
+            });
+        });
+        cout << "Batch enqueue/dequeue " << pairs << " pairs: " << batchTime << " ms, "
+             << batchAllocs << " allocations" << endl;
+        
+        size_t singleAllocs = 0;
+        long long singleTime = measureTime([&]() {
+            singleAllocs = countAllocations([&]() {
+                for (size_t done = 0; done < pairs; done++) {
+                    q.enqueue(std::move(inBuffer[done % batch]));
+                    inBuffer[done % batch] = q.dequeue();
+                }
+            });
+        });
+        cout << "Single enqueue/dequeue " << pairs << " pairs: " << singleTime << " ms, "
+             << singleAllocs << " allocations" << endl;
+        cout << endl;
+    }
+
+    template<typename PairFunc>
+    long long measureThreadPairs(size_t threadCount, size_t pairsPerThread, PairFunc&& onePair) {
+        return measureTime([&]() {
+            vector<thread> threads;
+            for (size_t t = 0; t < threadCount; t++) {
+                threads.emplace_back([&]() {
+                    string value(24, 'm');
+                    for (size_t i = 0; i < pairsPerThread; i++) {
+                        onePair(value);
+                    }
+                });
+            }
+            for (auto& worker : threads) {
+                worker.join();
+            }
+        });
+    }
+
+    void benchmarkMPMCQueue(int operations = 10000) {
+        size_t totalPairs = static_cast<size_t>(operations) * 25;
+        size_t maxThreads = max<size_t>(4, thread::hardware_concurrency());
+        cout << " MPMC Queue Thread Scaling (" << totalPairs
+             << " enqueue+dequeue pairs split across threads) " << endl;
+        
+        for (size_t threadCount = 1; threadCount <= maxThreads; threadCount *= 2) {
+            size_t perThread = totalPairs / threadCount;
+            
+            Queue locked;
+            mutex lock;
+            long long mutexTime = measureThreadPairs(threadCount, perThread, [&](string& value) {
+                {
+                    lock_guard<mutex> guard(lock);
+                    locked.enqueue(std::move(value));
+                }
+                for (;;) {
+                    {
+                        lock_guard<mutex> guard(lock);
+                        if (!locked.empty()) {
+                            value = locked.dequeue();
+                            break;
+                        }
+                    }
+                    this_thread::yield();
+                }
+            });
+            
+            MPMCQueue lockFree(1024);
+            long long lockFreeTime = measureThreadPairs(threadCount, perThread, [&](string& value) {
+                while (!lockFree.try_enqueue(std::move(value))) {
+                    this_thread::yield();
+                }
+                while (!lockFree.try_dequeue(value)) {
+                    this_thread::yield();
+                }
+            });
+            
+            cout << threadCount << " thread(s): Queue + mutex " << mutexTime
+                 << " ms, MPMCQueue " << lockFreeTime << " ms" << endl;
+        }
+        cout << endl;
+    }
+
+    // Один производитель выдает данные пачками с паузами, потребители ждут.
+    // Процессорное время показывает, сколько сжигает ожидание.
+    template<typename ProduceFunc, typename ConsumeFunc>
+    pair<long long, long long> measureWorkerPool(size_t consumers, int items,
+                                                ProduceFunc&& produce, ConsumeFunc&& consume) {
+        const int burst = 256;
+        clock_t cpuStart = clock();
+        long long wall = measureTime([&]() {
+            vector<thread> workers;
+            for (size_t c = 0; c < consumers; c++) {
+                workers.emplace_back([&]() {
+                    string value;
+                    while (consume(value)) {
+                    }
+                });
+            }
+            for (int i = 0; i < items; i++) {
+                produce(string(24, 'w'));
+                if (i % burst == burst - 1) {
+                    this_thread::sleep_for(chrono::milliseconds(1));
+                }
+            }
+            produce(string());
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        });
+        long long cpu = static_cast<long long>(clock() - cpuStart) * 1000 / CLOCKS_PER_SEC;
+        return make_pair(wall, cpu);
+    }
+
+    void benchmarkBlockingQueue(int operations = 10000) {
+        size_t consumers = 4;
+        cout << "Blocking Queue vs Polling (" << operations << " items, "
+             << consumers << " consumers, bursts with pauses)" << endl;
+        
+        // Пустая строка - сигнал остановки, остается в очереди для остальных
+        Queue polled;
+        mutex lock;
+        pair<long long, long long> polling = measureWorkerPool(consumers, operations,
+            [&](string value) {
+                lock_guard<mutex> guard(lock);
+                polled.enqueue(std::move(value));
+            },
+            [&](string& value) {
+                for (;;) {
+                    {
+                        lock_guard<mutex> guard(lock);
+                        if (!polled.empty()) {
+                            if (polled.front().empty()) {
+                                return false;
+                            }
+                            value = polled.dequeue();
+                            return true;
+                        }
+                    }
+                    this_thread::yield();
+                }
+            });
+        
+        BlockingQueue blocking(1024);
+        pair<long long, long long> waiting = measureWorkerPool(consumers, operations,
+            [&](string value) {
+                if (value.empty()) {
+                    blocking.close();
+                } else {
+                    blocking.enqueueWait(std::move(value), chrono::seconds(10));
+                }
+            },
+            [&](string& value) {
+                return blocking.dequeueWait(value, chrono::seconds(10));
+            });
+        
+        cout << "Queue + mutex polling: " << polling.first << " ms wall, "
+             << polling.second << " ms CPU" << endl;
+        cout << "BlockingQueue waits:   " << waiting.first << " ms wall, "
+             << waiting.second << " ms CPU" << endl;
         cout << endl;
     }
 
@@ -167,6 +1228,151 @@ public:
             }
         });
         cout << "Pop all elements: " << popTime << " ms" << endl;
+        
+        // Глубокий стек: раньше каждый pop проходил весь список
+        size_t depth = static_cast<size_t>(operations) * 10;
+        Stack deep;
+        long long deepTime = measureTime([&]() {
+            deep.reserve(depth);
+            for (size_t i = 0; i < depth; i++) {
+                deep.push(to_string(i));
+            }
+            while (!deep.empty()) {
+                deep.pop();
+            }
+        });
+        cout << "Push + pop " << depth << " elements (reserved): " << deepTime << " ms" << endl;
+        cout << endl;
+    }
+
+    void benchmarkConcurrentStack(int operations = 10000) {
+        size_t totalPairs = static_cast<size_t>(operations) * 25;
+        size_t maxThreads = max<size_t>(8, thread::hardware_concurrency());
+        cout << " Concurrent Stack Contention (" << totalPairs
+             << " push+pop pairs split across threads) " << endl;
+        
+        for (size_t threadCount = 1; threadCount <= maxThreads; threadCount *= 2) {
+            size_t perThread = totalPairs / threadCount;
+            
+            Stack locked;
+            mutex lock;
+            long long mutexTime = measureThreadPairs(threadCount, perThread, [&](string& value) {
+                lock_guard<mutex> guard(lock);
+                locked.push(std::move(value));
+                value = locked.pop();
+            });
+            
+            ConcurrentStack lockFree;
+            long long lockFreeTime = measureThreadPairs(threadCount, perThread, [&](string& value) {
+                lockFree.push(std::move(value));
+                while (!lockFree.try_pop(value)) {
+                    this_thread::yield();
+                }
+            });
+            
+            cout << threadCount << " thread(s): Stack + mutex " << mutexTime << " ms, ConcurrentStack "
+                 << lockFreeTime << " ms (" << lockFree.eliminatedPairs() << " eliminated, "
+                 << lockFree.pendingReclamation() << " nodes awaiting reclamation)" << endl;
+        }
+        cout << endl;
+    }
+
+    void benchmarkWorkStealingDeque(int operations = 10000) {
+        int items = operations * 25;
+        size_t maxThreads = max<size_t>(4, thread::hardware_concurrency());
+        cout << " Work-Stealing Deque Benchmark (" << items << " items) " << endl;
+        
+        // Пропускная способность кражи: владелец только кладет, воры забирают все
+        for (size_t thieves = 1; thieves < maxThreads; thieves *= 2) {
+            WorkStealingDeque<int> deque;
+            atomic<int> stolen(0);
+            atomic<long long> failed(0);
+            long long stealTime = measureTime([&]() {
+                vector<thread> threads;
+                for (size_t t = 0; t < thieves; t++) {
+                    threads.emplace_back([&]() {
+                        int value;
+                        long long misses = 0;
+                        while (stolen.load(memory_order_relaxed) < items) {
+                            if (deque.steal(value)) {
+                                stolen.fetch_add(1, memory_order_relaxed);
+                            } else {
+                                misses++;
+                                this_thread::yield();
+                            }
+                        }
+                        failed.fetch_add(misses);
+                    });
+                }
+                for (int i = 0; i < items; i++) {
+                    deque.push(i);
+                }
+                for (auto& worker : threads) {
+                    worker.join();
+                }
+            });
+            cout << thieves << " thief(s): " << items / max(1LL, stealTime) << " steals/ms, "
+                 << failed.load() << " empty or lost attempts" << endl;
+        }
+        
+        // Баланс нагрузки: вся работа стартует у воркера 0 и расходится кражами
+        struct Span {
+            int first;
+            int second;
+        };
+        for (size_t workerCount = 2; workerCount <= maxThreads; workerCount *= 2) {
+            vector<unique_ptr<WorkStealingDeque<Span>>> deques;
+            for (size_t w = 0; w < workerCount; w++) {
+                deques.push_back(make_unique<WorkStealingDeque<Span>>());
+            }
+            vector<size_t> executed(workerCount, 0);
+            atomic<int> pending(items);
+            atomic<size_t> checksum(0);
+            
+            long long balanceTime = measureTime([&]() {
+                deques[0]->push(Span{0, items});
+                auto run = [&](size_t self) {
+                    mt19937 rng(static_cast<unsigned>(self) + 7);
+                    size_t local = 0;
+                    Span task;
+                    while (pending.load(memory_order_acquire) > 0) {
+                        bool found = deques[self]->pop(task);
+                        for (size_t attempt = 0; !found && attempt < workerCount; attempt++) {
+                            size_t victim = rng() % workerCount;
+                            found = victim != self && deques[victim]->steal(task);
+                        }
+                        if (!found) {
+                            this_thread::yield();
+                            continue;
+                        }
+                        while (task.second - task.first > 64) {
+                            int middle = task.first + (task.second - task.first) / 2;
+                            deques[self]->push(Span{middle, task.second});
+                            task.second = middle;
+                        }
+                        for (int value = task.first; value < task.second; value++) {
+                            local += hash<int>()(value) % 7;
+                        }
+                        executed[self] += task.second - task.first;
+                        pending.fetch_sub(task.second - task.first, memory_order_acq_rel);
+                    }
+                    checksum.fetch_add(local);
+                };
+                vector<thread> threads;
+                for (size_t w = 1; w < workerCount; w++) {
+                    threads.emplace_back(run, w);
+                }
+                run(0);
+                for (auto& worker : threads) {
+                    worker.join();
+                }
+            });
+            
+            auto bounds = minmax_element(executed.begin(), executed.end());
+            cout << workerCount << " workers: " << balanceTime << " ms, busiest "
+                 << 100.0 * *bounds.second / items << "%, idlest " << 100.0 * *bounds.first / items
+                 << "% of items (ideal " << 100.0 / workerCount << "%, checksum " << checksum.load() << ")" << endl;
+        }
         cout << endl;
     }
 
@@ -222,10 +1428,32 @@ public:
         
         
         benchmarkArray(operations);
+        benchmarkArrayMoves(operations);
+        benchmarkArraySort(operations);
+        benchmarkArrayFind(operations);
+        benchmarkGenericArray(operations);
+        benchmarkArenaArray(operations);
+        benchmarkTieredArray(operations);
+        benchmarkSortedArray(operations);
+        benchmarkCowArray(operations);
+        benchmarkMappedArray(operations);
+        benchmarkSmallArray(operations);
         benchmarkSinglyLinkedList(operations);
         benchmarkDoublyLinkedList(operations);
+        benchmarkListNodePool(operations);
+        benchmarkUnrolledList(operations);
+        benchmarkListIteration(operations);
+        benchmarkIndexedList(operations);
+        benchmarkListSpliceSort(operations);
+        benchmarkListDedup(operations);
+        benchmarkIntrusiveList(operations);
+        benchmarkCompactList(operations);
         benchmarkQueue(operations);
+        benchmarkMPMCQueue(operations);
+        benchmarkBlockingQueue(operations);
         benchmarkStack(operations);
+        benchmarkConcurrentStack(operations);
+        benchmarkWorkStealingDeque(operations);
         benchmarkHashTable(operations);
         benchmarkTree(operations);
         
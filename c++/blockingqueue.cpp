@@ -0,0 +1,121 @@
+#include "blockingqueue.h"
+#include <algorithm>
+
+BlockingQueue::BlockingQueue(size_t capacity)
+    : items(), maxSize(capacity), closed(false), waitingConsumers(0), waitingProducers(0) {}
+
+bool BlockingQueue::hasRoom() const {
+    return maxSize == 0 || items.size() < maxSize;
+}
+
+bool BlockingQueue::waitForRoom(std::unique_lock<std::mutex>& guard, std::chrono::milliseconds timeout) {
+    if (!closed && !hasRoom()) {
+        waitingProducers++;
+        notFull.wait_for(guard, timeout, [this]() { return closed || hasRoom(); });
+        waitingProducers--;
+    }
+    return !closed && hasRoom();
+}
+
+bool BlockingQueue::waitForItems(std::unique_lock<std::mutex>& guard, std::chrono::milliseconds timeout) {
+    if (!closed && items.empty()) {
+        waitingConsumers++;
+        notEmpty.wait_for(guard, timeout, [this]() { return closed || !items.empty(); });
+        waitingConsumers--;
+    }
+    return !items.empty();
+}
+
+void BlockingQueue::wakeConsumers(std::unique_lock<std::mutex>& guard, size_t added) {
+    // Будим не больше потоков, чем появилось элементов: остальные все равно
+    // уснули бы снова
+    size_t wakeups = std::min(added, waitingConsumers);
+    guard.unlock();
+    // Будим после снятия блокировки, чтобы проснувшийся не уперся в нее же
+    for (size_t i = 0; i < wakeups; ++i) {
+        notEmpty.notify_one();
+    }
+}
+
+void BlockingQueue::wakeProducers(std::unique_lock<std::mutex>& guard, size_t removed) {
+    size_t wakeups = std::min(removed, waitingProducers);
+    guard.unlock();
+    for (size_t i = 0; i < wakeups; ++i) {
+        notFull.notify_one();
+    }
+}
+
+bool BlockingQueue::enqueueWait(const std::string& value, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> guard(lock);
+    if (!waitForRoom(guard, timeout)) {
+        return false;
+    }
+    items.enqueue(value);
+    wakeConsumers(guard, 1);
+    return true;
+}
+
+bool BlockingQueue::enqueueWait(std::string&& value, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> guard(lock);
+    if (!waitForRoom(guard, timeout)) {
+        return false;
+    }
+    items.enqueue(std::move(value));
+    wakeConsumers(guard, 1);
+    return true;
+}
+
+bool BlockingQueue::dequeueWait(std::string& out, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> guard(lock);
+    if (!waitForItems(guard, timeout)) {
+        return false;
+    }
+    out = items.dequeue();
+    wakeProducers(guard, 1);
+    return true;
+}
+
+void BlockingQueue::close() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        closed = true;
+    }
+    notEmpty.notify_all();
+    notFull.notify_all();
+}
+
+bool BlockingQueue::isClosed() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return closed;
+}
+
+size_t BlockingQueue::size() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return items.size();
+}
+
+bool BlockingQueue::empty() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return items.empty();
+}
+
+size_t BlockingQueue::capacity() const {
+    return maxSize;
+}
+
+void BlockingQueue::print() const {
+    std::lock_guard<std::mutex> guard(lock);
+    items.print();
+}
+
+void BlockingQueue::serialize(std::ostream& os) const {
+    std::lock_guard<std::mutex> guard(lock);
+    items.serialize(os);
+}
+
+void BlockingQueue::deserialize(std::istream& is) {
+    std::unique_lock<std::mutex> guard(lock);
+    items.deserialize(is);
+    // Ограничение емкости не мешает загрузить снимок целиком
+    wakeConsumers(guard, items.size());
+}
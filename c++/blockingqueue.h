@@ -0,0 +1,94 @@
+#ifndef BLOCKINGQUEUE_H
+#define BLOCKINGQUEUE_H
+
+#include "queue.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <utility>
+
+// Блокирующая очередь поверх Queue для пулов потоков: потребитель спит на
+// условной переменной, пока нет данных, производитель - пока ограниченная
+// очередь заполнена (capacity = 0 - без ограничения). Уведомления идут
+// только при наличии ждущих потоков, и будится не больше потоков, чем
+// появилось элементов или мест: пакет из двух элементов не поднимает всех
+// спящих потребителей. close() будит всех: дальнейшие
+// вставки отклоняются, а извлечение дочитывает остаток.
+// Формат сериализации совпадает с Queue.
+class BlockingQueue {
+private:
+    Queue items;
+    size_t maxSize;
+    bool closed;
+    size_t waitingConsumers;
+    size_t waitingProducers;
+    mutable std::mutex lock;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+    
+    bool hasRoom() const;
+    // Ждет места для вставки; false по таймауту или после close()
+    bool waitForRoom(std::unique_lock<std::mutex>& guard, std::chrono::milliseconds timeout);
+    // Ждет данных; false, если их нет по истечении таймаута
+    bool waitForItems(std::unique_lock<std::mutex>& guard, std::chrono::milliseconds timeout);
+    void wakeConsumers(std::unique_lock<std::mutex>& guard, size_t added);
+    void wakeProducers(std::unique_lock<std::mutex>& guard, size_t removed);
+
+public:
+    explicit BlockingQueue(size_t capacity = 0);
+    
+    BlockingQueue(const BlockingQueue&) = delete;
+    BlockingQueue& operator=(const BlockingQueue&) = delete;
+    
+    // false, если за timeout место не освободилось или очередь закрыта
+    bool enqueueWait(const std::string& value, std::chrono::milliseconds timeout);
+    bool enqueueWait(std::string&& value, std::chrono::milliseconds timeout);
+    // false, если за timeout ничего не появилось
+    bool dequeueWait(std::string& out, std::chrono::milliseconds timeout);
+    
+    // Перемещает элементы диапазона, пока есть место; возвращает их число
+    template<typename InputIt>
+    size_t enqueueBatchWait(InputIt first, InputIt last, std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> guard(lock);
+        size_t added = 0;
+        while (first != last && waitForRoom(guard, added == 0 ? timeout : std::chrono::milliseconds(0))) {
+            while (first != last && hasRoom()) {
+                items.enqueue(std::move(*first));
+                ++first;
+                added++;
+            }
+        }
+        wakeConsumers(guard, added);
+        return added;
+    }
+    
+    // Ждет хотя бы один элемент и забирает до maxCount сразу
+    template<typename OutputIt>
+    size_t dequeueBatchWait(OutputIt out, size_t maxCount, std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> guard(lock);
+        if (maxCount == 0 || !waitForItems(guard, timeout)) {
+            return 0;
+        }
+        size_t taken = items.dequeueBatch(out, maxCount);
+        wakeProducers(guard, taken);
+        return taken;
+    }
+    
+    void close();
+    bool isClosed() const;
+    
+    size_t size() const;
+    bool empty() const;
+    size_t capacity() const;
+    
+    void print() const;
+    
+    void serialize(std::ostream& os) const;
+    void deserialize(std::istream& is);
+};
+
+#endif
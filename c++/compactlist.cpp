@@ -0,0 +1,438 @@
+#include "compactlist.h"
+#include <algorithm>
+#include <utility>
+
+namespace {
+    // Сколько байт осталось в потоке; false, если поток не позиционируемый
+    bool remainingBytes(std::istream& is, size_t& remaining) {
+        std::streampos current = is.tellg();
+        if (current == std::streampos(-1)) {
+            is.clear();
+            return false;
+        }
+        is.seekg(0, std::ios::end);
+        std::streampos end = is.tellg();
+        is.clear();
+        is.seekg(current);
+        if (end == std::streampos(-1) || end < current) {
+            return false;
+        }
+        remaining = static_cast<size_t>(end - current);
+        return true;
+    }
+}
+
+CompactList::CompactList()
+    : nextLinks(), prevLinks(), values(), head(NIL), tail(NIL), freeHead(NIL), listSize(0),
+      cursor(NIL), cursorIndex(0) {}
+
+uint32_t CompactList::allocateSlot(const std::string& value) {
+    if (freeHead != NIL) {
+        uint32_t slot = freeHead;
+        freeHead = nextLinks[slot];
+        values[slot] = value;
+        return slot;
+    }
+    if (values.size() >= NIL) {
+        throw std::length_error("List size limit exceeded");
+    }
+    uint32_t slot = static_cast<uint32_t>(values.size());
+    values.push_back(value);
+    nextLinks.push_back(NIL);
+    prevLinks.push_back(NIL);
+    return slot;
+}
+
+void CompactList::releaseSlot(uint32_t slot) {
+    // Память строки остается за слотом и пригодится следующему значению
+    values[slot].clear();
+    prevLinks[slot] = NIL;
+    nextLinks[slot] = freeHead;
+    freeHead = slot;
+}
+
+void CompactList::linkBefore(uint32_t position, uint32_t slot) {
+    uint32_t before = (position == NIL) ? tail : prevLinks[position];
+    prevLinks[slot] = before;
+    nextLinks[slot] = position;
+    if (before == NIL) {
+        head = slot;
+    } else {
+        nextLinks[before] = slot;
+    }
+    if (position == NIL) {
+        tail = slot;
+    } else {
+        prevLinks[position] = slot;
+    }
+    listSize++;
+}
+
+void CompactList::unlink(uint32_t slot) {
+    uint32_t before = prevLinks[slot];
+    uint32_t after = nextLinks[slot];
+    if (before == NIL) {
+        head = after;
+    } else {
+        nextLinks[before] = after;
+    }
+    if (after == NIL) {
+        tail = before;
+    } else {
+        prevLinks[after] = before;
+    }
+    listSize--;
+    releaseSlot(slot);
+}
+
+uint32_t CompactList::slotAt(size_t index) const {
+    // Идем от ближайшей из трех точек: головы, хвоста или курсора
+    uint32_t current = head;
+    size_t position = 0;
+    size_t distance = index;
+    if (listSize - 1 - index < distance) {
+        current = tail;
+        position = listSize - 1;
+        distance = listSize - 1 - index;
+    }
+    if (cursor != NIL) {
+        size_t cursorDistance = (cursorIndex > index) ? cursorIndex - index : index - cursorIndex;
+        if (cursorDistance < distance) {
+            current = cursor;
+            position = cursorIndex;
+        }
+    }
+    while (position < index) {
+        current = nextLinks[current];
+        position++;
+    }
+    while (position > index) {
+        current = prevLinks[current];
+        position--;
+    }
+    cursor = current;
+    cursorIndex = index;
+    return current;
+}
+
+void CompactList::resetCursor() const {
+    cursor = NIL;
+    cursorIndex = 0;
+}
+
+void CompactList::push_front(const std::string& value) {
+    linkBefore(head, allocateSlot(value));
+    if (cursor != NIL) {
+        cursorIndex++;
+    }
+}
+
+void CompactList::push_back(const std::string& value) {
+    linkBefore(NIL, allocateSlot(value));
+}
+
+void CompactList::pop_front() {
+    if (empty()) {
+        throw std::runtime_error("List is empty");
+    }
+    
+    if (cursor == head) {
+        resetCursor();
+    } else if (cursor != NIL) {
+        cursorIndex--;
+    }
+    unlink(head);
+}
+
+void CompactList::pop_back() {
+    if (empty()) {
+        throw std::runtime_error("List is empty");
+    }
+    
+    if (cursor == tail) {
+        resetCursor();
+    }
+    unlink(tail);
+}
+
+void CompactList::insert(size_t index, const std::string& value) {
+    if (index > listSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    
+    if (index == 0) {
+        push_front(value);
+    } else if (index == listSize) {
+        push_back(value);
+    } else {
+        uint32_t position = slotAt(index);
+        uint32_t slot = allocateSlot(value);
+        linkBefore(position, slot);
+        cursor = slot;
+        cursorIndex = index;
+    }
+}
+
+void CompactList::remove(size_t index) {
+    if (index >= listSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    
+    if (index == 0) {
+        pop_front();
+    } else if (index == listSize - 1) {
+        pop_back();
+    } else {
+        uint32_t slot = slotAt(index);
+        uint32_t before = prevLinks[slot];
+        unlink(slot);
+        cursor = before;
+        cursorIndex = index - 1;
+    }
+}
+
+std::string CompactList::get(size_t index) const {
+    if (index >= listSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    return values[slotAt(index)];
+}
+
+void CompactList::set(size_t index, const std::string& value) {
+    if (index >= listSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    values[slotAt(index)] = value;
+}
+
+size_t CompactList::size() const {
+    return listSize;
+}
+
+bool CompactList::empty() const {
+    return listSize == 0;
+}
+
+void CompactList::reserve(size_t count) {
+    if (count > NIL) {
+        throw std::length_error("List size limit exceeded");
+    }
+    nextLinks.reserve(count);
+    prevLinks.reserve(count);
+    values.reserve(count);
+}
+
+size_t CompactList::capacity() const {
+    return values.size();
+}
+
+void CompactList::compact() {
+    std::vector<std::string> ordered;
+    ordered.reserve(listSize);
+    for (uint32_t slot = head; slot != NIL; slot = nextLinks[slot]) {
+        ordered.push_back(std::move(values[slot]));
+    }
+    
+    values.swap(ordered);
+    std::vector<uint32_t>().swap(nextLinks);
+    std::vector<uint32_t>().swap(prevLinks);
+    relinkSequential();
+}
+
+void CompactList::relinkSequential() {
+    nextLinks.resize(listSize);
+    prevLinks.resize(listSize);
+    for (size_t i = 0; i < listSize; ++i) {
+        nextLinks[i] = (i + 1 < listSize) ? static_cast<uint32_t>(i + 1) : NIL;
+        prevLinks[i] = (i > 0) ? static_cast<uint32_t>(i - 1) : NIL;
+    }
+    head = empty() ? NIL : 0;
+    tail = empty() ? NIL : static_cast<uint32_t>(listSize - 1);
+    freeHead = NIL;
+    resetCursor();
+}
+
+size_t CompactList::memoryUsage() const {
+    return sizeof(CompactList) +
+           nextLinks.capacity() * sizeof(uint32_t) +
+           prevLinks.capacity() * sizeof(uint32_t) +
+           values.capacity() * sizeof(std::string);
+}
+
+bool CompactList::checkIntegrity() const {
+    if (empty()) {
+        return head == NIL && tail == NIL;
+    }
+    
+    size_t forwardCount = 0;
+    uint32_t last = NIL;
+    for (uint32_t slot = head; slot != NIL && forwardCount <= listSize; slot = nextLinks[slot]) {
+        if (prevLinks[slot] != last) {
+            return false;
+        }
+        forwardCount++;
+        last = slot;
+    }
+    
+    // Свободные слоты и живые элементы вместе покрывают все слоты
+    size_t freeCount = 0;
+    for (uint32_t slot = freeHead; slot != NIL && freeCount <= values.size(); slot = nextLinks[slot]) {
+        freeCount++;
+    }
+    
+    return forwardCount == listSize && last == tail && listSize + freeCount == values.size();
+}
+
+std::vector<std::string> CompactList::toVector() const {
+    std::vector<std::string> result;
+    result.reserve(listSize);
+    for (uint32_t slot = head; slot != NIL; slot = nextLinks[slot]) {
+        result.push_back(values[slot]);
+    }
+    return result;
+}
+
+bool CompactList::contains(const std::string& value) const {
+    for (uint32_t slot = head; slot != NIL; slot = nextLinks[slot]) {
+        if (values[slot] == value) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void CompactList::clear() {
+    nextLinks.clear();
+    prevLinks.clear();
+    values.clear();
+    head = NIL;
+    tail = NIL;
+    freeHead = NIL;
+    listSize = 0;
+    resetCursor();
+}
+
+void CompactList::print() const {
+    if (empty()) {
+        std::cout << "CompactList: [empty]" << std::endl;
+        return;
+    }
+    
+    std::cout << "CompactList: [";
+    for (uint32_t slot = head; slot != NIL; slot = nextLinks[slot]) {
+        std::cout << "\"" << values[slot] << "\"";
+        if (nextLinks[slot] != NIL) std::cout << " <-> ";
+    }
+    std::cout << "]" << std::endl;
+}
+
+void CompactList::serialize(std::ostream& os) const {
+    os.write(reinterpret_cast<const char*>(&listSize), sizeof(listSize));
+    
+    // Собираем длины и данные в общий буфер, чтобы писать в поток крупными кусками
+    std::string buffer;
+    buffer.reserve(SERIALIZE_BUFFER_BYTES);
+    for (uint32_t slot = head; slot != NIL; slot = nextLinks[slot]) {
+        const std::string& value = values[slot];
+        size_t strLen = value.length();
+        if (buffer.size() + sizeof(strLen) + strLen > SERIALIZE_BUFFER_BYTES && !buffer.empty()) {
+            os.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+        buffer.append(reinterpret_cast<const char*>(&strLen), sizeof(strLen));
+        buffer.append(value);
+    }
+    os.write(buffer.data(), buffer.size());
+}
+
+void CompactList::deserialize(std::istream& is) {
+    size_t listSizeValue;
+    if (!is.read(reinterpret_cast<char*>(&listSizeValue), sizeof(listSizeValue))) {
+        throw std::runtime_error("Invalid list stream");
+    }
+    if (listSizeValue > NIL) {
+        throw std::length_error("List size limit exceeded");
+    }
+    
+    // Счетчику из потока не верим: каждый элемент занимает в потоке хотя бы
+    // свою длину, поэтому резервируем не больше, чем поток может вместить.
+    // Читаем во временные массивы, чтобы при ошибке список остался прежним.
+    size_t available = 0;
+    bool bounded = remainingBytes(is, available);
+    size_t reserveLimit = bounded ? available / sizeof(size_t) : SERIALIZE_BUFFER_BYTES / sizeof(size_t);
+    std::vector<std::string> loaded;
+    loaded.reserve(std::min(listSizeValue, reserveLimit));
+    for (size_t i = 0; i < listSizeValue; ++i) {
+        size_t strLen;
+        if (!is.read(reinterpret_cast<char*>(&strLen), sizeof(strLen))) {
+            throw std::runtime_error("Invalid list stream");
+        }
+        if (bounded) {
+            available -= sizeof(strLen);
+            if (strLen > available) {
+                throw std::runtime_error("Invalid list stream");
+            }
+            available -= strLen;
+        }
+        loaded.emplace_back(strLen, ' ');
+        if (!is.read(&loaded.back()[0], strLen)) {
+            throw std::runtime_error("Invalid list stream");
+        }
+    }
+    std::vector<uint32_t> loadedNext(listSizeValue);
+    std::vector<uint32_t> loadedPrev(listSizeValue);
+    
+    // Дальше ничего не выделяется: связи проставляются одним проходом
+    values.swap(loaded);
+    nextLinks.swap(loadedNext);
+    prevLinks.swap(loadedPrev);
+    listSize = listSizeValue;
+    relinkSequential();
+}
+
+void CompactList::serializeText(std::ostream& os) const {
+    os << listSize << "\n";
+    for (uint32_t slot = head; slot != NIL; slot = nextLinks[slot]) {
+        std::string escaped = values[slot];
+        size_t pos = 0;
+        while ((pos = escaped.find('\n', pos)) != std::string::npos) {
+            escaped.replace(pos, 1, "\\n");
+            pos += 2;
+        }
+        pos = 0;
+        while ((pos = escaped.find('\"', pos)) != std::string::npos) {
+            escaped.replace(pos, 1, "\\\"");
+            pos += 2;
+        }
+        os << "\"" << escaped << "\"\n";
+    }
+}
+
+void CompactList::deserializeText(std::istream& is) {
+    clear();
+    size_t newSize;
+    is >> newSize;
+    is.get();
+    
+    for (size_t i = 0; i < newSize; ++i) {
+        std::string line;
+        std::getline(is, line);
+        
+        if (line.size() >= 2 && line.front() == '\"' && line.back() == '\"') {
+            line = line.substr(1, line.size() - 2);
+            
+            size_t pos = 0;
+            while ((pos = line.find("\\n", pos)) != std::string::npos) {
+                line.replace(pos, 2, "\n");
+                pos += 1;
+            }
+            pos = 0;
+            while ((pos = line.find("\\\"", pos)) != std::string::npos) {
+                line.replace(pos, 2, "\"");
+                pos += 1;
+            }
+        }
+        
+        push_back(line);
+    }
+}
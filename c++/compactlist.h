@@ -0,0 +1,93 @@
+#ifndef COMPACTLIST_H
+#define COMPACTLIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Двусвязный список в параллельных массивах: связи - 32-битные номера слотов
+// (8 байт на элемент вместо двух указателей по 8), строки лежат в отдельном
+// массиве значений. Освобожденные слоты уходят в список свободных и
+// переиспользуются, поэтому узлы не выделяются по одному. После compact()
+// слоты идут в порядке списка, и обход становится последовательным чтением.
+// Интерфейс и формат сериализации совпадают с DoublyLinkedList.
+class CompactList {
+public:
+    static constexpr uint32_t NIL = UINT32_MAX;
+
+private:
+    static const size_t SERIALIZE_BUFFER_BYTES = 64 * 1024;
+    
+    std::vector<uint32_t> nextLinks;   // У свободного слота - следующий свободный
+    std::vector<uint32_t> prevLinks;
+    std::vector<std::string> values;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t freeHead;
+    size_t listSize;
+    
+    // Курсор последнего обращения по индексу, как у DoublyLinkedList
+    mutable uint32_t cursor;
+    mutable size_t cursorIndex;
+    
+    uint32_t allocateSlot(const std::string& value);
+    void releaseSlot(uint32_t slot);
+    // Вставляет slot перед position; position == NIL - в конец
+    void linkBefore(uint32_t position, uint32_t slot);
+    void unlink(uint32_t slot);
+    uint32_t slotAt(size_t index) const;
+    void resetCursor() const;
+    // Связывает первые listSize слотов по порядку, свободных не остается
+    void relinkSequential();
+
+public:
+    CompactList();
+    
+    void push_front(const std::string& value);
+    void push_back(const std::string& value);
+    void pop_front();
+    void pop_back();
+    void insert(size_t index, const std::string& value);
+    void remove(size_t index);
+    std::string get(size_t index) const;
+    void set(size_t index, const std::string& value);
+    size_t size() const;
+    bool empty() const;
+    
+    // Обход всех элементов по порядку без копирования
+    template<typename Visitor>
+    void forEach(Visitor&& visit) const {
+        for (uint32_t slot = head; slot != NIL; slot = nextLinks[slot]) {
+            visit(values[slot]);
+        }
+    }
+    
+    void reserve(size_t count);
+    // Число слотов, включая свободные
+    size_t capacity() const;
+    // Переупорядочивает слоты по порядку списка и отдает лишнюю память
+    void compact();
+    // Байты на массивы связей и значений (без содержимого длинных строк)
+    size_t memoryUsage() const;
+    
+    bool checkIntegrity() const;
+    std::vector<std::string> toVector() const;
+    bool contains(const std::string& value) const;
+    
+    void clear();
+    void print() const;
+    
+    // Бинарная сериализация (совместима со связными списками)
+    void serialize(std::ostream& os) const;
+    // При обрезанном или испорченном потоке бросает исключение, список не меняется
+    void deserialize(std::istream& is);
+    
+    // Текстовая сериализация
+    void serializeText(std::ostream& os) const;
+    void deserializeText(std::istream& is);
+};
+
+#endif
@@ -0,0 +1,247 @@
+#include "concurrentstack.h"
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+    // Стартовая позиция поиска слота и генератор для массива исключения
+    size_t threadSeed() {
+        thread_local size_t seed = std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        return seed;
+    }
+}
+
+ConcurrentStack::Guard::Guard(ConcurrentStack& stack) : owner(stack), participant(nullptr), epoch(0) {
+    // Занимаем свободный слот; если все заняты, ждем освобождения
+    size_t start = threadSeed();
+    while (participant == nullptr) {
+        for (size_t i = 0; i < MAX_PARTICIPANTS; ++i) {
+            Participant& candidate = owner.participants[(start + i) % MAX_PARTICIPANTS];
+            size_t idle = 0;
+            if (candidate.state.load(std::memory_order_relaxed) == 0 &&
+                candidate.state.compare_exchange_strong(idle, CLAIMED, std::memory_order_acquire)) {
+                participant = &candidate;
+                break;
+            }
+        }
+        if (participant == nullptr) {
+            std::this_thread::yield();
+        }
+    }
+    
+    // Объявленная эпоха должна совпасть с глобальной после объявления
+    for (;;) {
+        epoch = owner.globalEpoch.load(std::memory_order_seq_cst);
+        participant->state.store((epoch << 1) | 1, std::memory_order_seq_cst);
+        if (owner.globalEpoch.load(std::memory_order_seq_cst) == epoch) {
+            break;
+        }
+    }
+}
+
+ConcurrentStack::Guard::~Guard() {
+    participant->state.store(0, std::memory_order_release);
+}
+
+ConcurrentStack::ConcurrentStack()
+    : top(nullptr), globalEpoch(0), reclaiming(false), retireCounter(0), pending(0), eliminations(0) {
+    for (size_t i = 0; i < EPOCH_BUCKETS; ++i) {
+        retired[i].store(nullptr, std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < MAX_PARTICIPANTS; ++i) {
+        participants[i].state.store(0, std::memory_order_relaxed);
+    }
+    for (size_t i = 0; i < ELIMINATION_SLOTS; ++i) {
+        elimination[i].offer.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+ConcurrentStack::~ConcurrentStack() {
+    deleteChain(top.load(std::memory_order_relaxed));
+    for (size_t i = 0; i < EPOCH_BUCKETS; ++i) {
+        deleteChain(retired[i].load(std::memory_order_relaxed));
+    }
+}
+
+void ConcurrentStack::deleteChain(Node* node) {
+    while (node != nullptr) {
+        Node* next = node->next.load(std::memory_order_relaxed);
+        delete node;
+        node = next;
+    }
+}
+
+void ConcurrentStack::retire(Node* node, size_t epoch) {
+    // Снятый узел уходит в корзину эпохи, в которой его сняли
+    std::atomic<Node*>& bucket = retired[epoch % EPOCH_BUCKETS];
+    Node* head = bucket.load(std::memory_order_relaxed);
+    do {
+        node->next.store(head, std::memory_order_relaxed);
+    } while (!bucket.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+    pending.fetch_add(1, std::memory_order_relaxed);
+    
+    if (retireCounter.fetch_add(1, std::memory_order_relaxed) % RECLAIM_PERIOD == RECLAIM_PERIOD - 1) {
+        tryReclaim();
+    }
+}
+
+void ConcurrentStack::tryReclaim() {
+    // Продвигает эпоху один поток; остальные не ждут и просто продолжают
+    if (reclaiming.exchange(true, std::memory_order_acquire)) {
+        return;
+    }
+    
+    size_t epoch = globalEpoch.load(std::memory_order_seq_cst);
+    bool everyoneCaughtUp = true;
+    for (size_t i = 0; i < MAX_PARTICIPANTS; ++i) {
+        size_t state = participants[i].state.load(std::memory_order_seq_cst);
+        if ((state & 1) != 0 && (state >> 1) != epoch) {
+            everyoneCaughtUp = false;
+            break;
+        }
+    }
+    
+    Node* reclaimable = nullptr;
+    if (everyoneCaughtUp) {
+        // Все активные видят epoch, значит узлы из epoch - 2 никто не держит.
+        // Их корзина освобождается до смены эпохи, пока в нее никто не пишет.
+        reclaimable = retired[(epoch + 1) % EPOCH_BUCKETS].exchange(nullptr, std::memory_order_acquire);
+        globalEpoch.store(epoch + 1, std::memory_order_seq_cst);
+    }
+    reclaiming.store(false, std::memory_order_release);
+    
+    size_t freed = 0;
+    while (reclaimable != nullptr) {
+        Node* next = reclaimable->next.load(std::memory_order_relaxed);
+        delete reclaimable;
+        reclaimable = next;
+        freed++;
+    }
+    pending.fetch_sub(freed, std::memory_order_relaxed);
+}
+
+bool ConcurrentStack::offerToPop(Node* node) {
+    EliminationSlot& slot = elimination[threadSeed() % ELIMINATION_SLOTS];
+    Node* empty = nullptr;
+    if (!slot.offer.compare_exchange_strong(empty, node, std::memory_order_release, std::memory_order_relaxed)) {
+        return false;
+    }
+    for (size_t spin = 0; spin < ELIMINATION_SPINS; ++spin) {
+        if (slot.offer.load(std::memory_order_acquire) != node) {
+            break;
+        }
+    }
+    // Если забрать предложение назад не удалось, узел уже у pop
+    Node* offered = node;
+    if (slot.offer.compare_exchange_strong(offered, nullptr, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+        return false;
+    }
+    eliminations.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+ConcurrentStack::Node* ConcurrentStack::takeFromPush() {
+    EliminationSlot& slot = elimination[threadSeed() % ELIMINATION_SLOTS];
+    Node* offered = slot.offer.load(std::memory_order_acquire);
+    if (offered != nullptr &&
+        slot.offer.compare_exchange_strong(offered, nullptr, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+        return offered;
+    }
+    return nullptr;
+}
+
+void ConcurrentStack::pushNode(Node* node) {
+    Guard guard(*this);
+    Node* head = top.load(std::memory_order_relaxed);
+    for (;;) {
+        node->next.store(head, std::memory_order_relaxed);
+        if (top.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed)) {
+            return;
+        }
+        if (offerToPop(node)) {
+            return;
+        }
+        head = top.load(std::memory_order_relaxed);
+    }
+}
+
+void ConcurrentStack::push(const std::string& value) {
+    pushNode(new Node(value));
+}
+
+void ConcurrentStack::push(std::string&& value) {
+    pushNode(new Node(std::move(value)));
+}
+
+bool ConcurrentStack::try_pop(std::string& out) {
+    Guard guard(*this);
+    Node* head = top.load(std::memory_order_acquire);
+    for (;;) {
+        if (head == nullptr) {
+            return false;
+        }
+        // head не освободят, пока действует guard, поэтому next читать безопасно
+        Node* next = head->next.load(std::memory_order_relaxed);
+        if (top.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_acquire)) {
+            break;
+        }
+        Node* eliminated = takeFromPush();
+        if (eliminated != nullptr) {
+            head = eliminated;
+            break;
+        }
+        head = top.load(std::memory_order_acquire);
+    }
+    
+    out = std::move(head->data);
+    retire(head, guard.currentEpoch());
+    return true;
+}
+
+bool ConcurrentStack::empty() const {
+    return top.load(std::memory_order_acquire) == nullptr;
+}
+
+size_t ConcurrentStack::pendingReclamation() const {
+    return pending.load(std::memory_order_relaxed);
+}
+
+size_t ConcurrentStack::eliminatedPairs() const {
+    return eliminations.load(std::memory_order_relaxed);
+}
+
+void ConcurrentStack::serialize(std::ostream& os) const {
+    // Stack пишет от дна к вершине, а узлы связаны от вершины
+    std::vector<const std::string*> values;
+    for (Node* node = top.load(std::memory_order_acquire); node != nullptr;
+         node = node->next.load(std::memory_order_relaxed)) {
+        values.push_back(&node->data);
+    }
+    size_t count = values.size();
+    os.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    for (size_t i = count; i-- > 0;) {
+        size_t strLen = values[i]->length();
+        os.write(reinterpret_cast<const char*>(&strLen), sizeof(strLen));
+        os.write(values[i]->c_str(), strLen);
+    }
+}
+
+void ConcurrentStack::deserialize(std::istream& is) {
+    std::string discarded;
+    while (try_pop(discarded)) {
+    }
+    
+    size_t count;
+    is.read(reinterpret_cast<char*>(&count), sizeof(count));
+    for (size_t i = 0; i < count; ++i) {
+        size_t strLen;
+        is.read(reinterpret_cast<char*>(&strLen), sizeof(strLen));
+        std::string value(strLen, ' ');
+        is.read(&value[0], strLen);
+        push(std::move(value));
+    }
+}
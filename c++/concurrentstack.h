@@ -0,0 +1,104 @@
+#ifndef CONCURRENTSTACK_H
+#define CONCURRENTSTACK_H
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+// Lock-free стек Трайбера для нескольких потоков. Вершина меняется CAS-ом,
+// снятые узлы не удаляются сразу, а откладываются до смены двух эпох
+// (epoch-based reclamation): каждая операция объявляет текущую эпоху в
+// слоте участника, и эпоха продвигается, только когда все активные
+// участники ее увидели. Поэтому узел, который еще читает соседний поток,
+// не может быть освобожден, а CAS не страдает от ABA.
+// При неудачном CAS операция пробует встретиться со встречной в массиве
+// исключения (elimination backoff): push отдает узел pop напрямую, минуя
+// вершину. Однопоточный Stack из stack.h остается без изменений.
+class ConcurrentStack {
+private:
+    static const size_t CACHE_LINE = 64;
+    static const size_t MAX_PARTICIPANTS = 64;
+    static const size_t ELIMINATION_SLOTS = 8;
+    static const size_t ELIMINATION_SPINS = 64;
+    static const size_t RECLAIM_PERIOD = 64;
+    static const size_t EPOCH_BUCKETS = 3;
+    
+    // next атомарный: pop может читать его у узла, который соседний поток
+    // уже снял и перевязывает в корзину
+    struct Node {
+        std::string data;
+        std::atomic<Node*> next;
+        explicit Node(const std::string& value) : data(value), next(nullptr) {}
+        explicit Node(std::string&& value) : data(std::move(value)), next(nullptr) {}
+    };
+    
+    // Состояние участника: 0 - слот свободен, CLAIMED - занят, но эпоха еще
+    // не объявлена, иначе (эпоха << 1) | 1
+    static const size_t CLAIMED = 2;
+    
+    struct alignas(CACHE_LINE) Participant {
+        std::atomic<size_t> state;
+    };
+    
+    struct alignas(CACHE_LINE) EliminationSlot {
+        std::atomic<Node*> offer;
+    };
+    
+    // Объявление эпохи на время одной операции
+    class Guard {
+    private:
+        ConcurrentStack& owner;
+        Participant* participant;
+        size_t epoch;
+    
+    public:
+        explicit Guard(ConcurrentStack& stack);
+        ~Guard();
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+        
+        size_t currentEpoch() const { return epoch; }
+    };
+    
+    alignas(CACHE_LINE) std::atomic<Node*> top;
+    alignas(CACHE_LINE) std::atomic<size_t> globalEpoch;
+    std::atomic<bool> reclaiming;
+    std::atomic<size_t> retireCounter;
+    std::atomic<size_t> pending;
+    std::atomic<size_t> eliminations;
+    std::atomic<Node*> retired[EPOCH_BUCKETS];
+    Participant participants[MAX_PARTICIPANTS];
+    EliminationSlot elimination[ELIMINATION_SLOTS];
+    
+    void pushNode(Node* node);
+    void retire(Node* node, size_t epoch);
+    void tryReclaim();
+    static void deleteChain(Node* node);
+    
+    bool offerToPop(Node* node);
+    Node* takeFromPush();
+
+public:
+    ConcurrentStack();
+    ~ConcurrentStack();
+    
+    ConcurrentStack(const ConcurrentStack&) = delete;
+    ConcurrentStack& operator=(const ConcurrentStack&) = delete;
+    
+    void push(const std::string& value);
+    void push(std::string&& value);
+    // false, если стек пуст
+    bool try_pop(std::string& out);
+    bool empty() const;
+    
+    // Статистика для тестов и бенчмарков
+    size_t pendingReclamation() const;
+    size_t eliminatedPairs() const;
+    
+    // Формат совпадает со Stack; допустимо только без параллельных операций
+    void serialize(std::ostream& os) const;
+    void deserialize(std::istream& is);
+};
+
+#endif
@@ -0,0 +1,237 @@
+#include "cowarray.h"
+#include <atomic>
+#include <utility>
+
+CowArray::CowArray() : table(), currentSize(0) {}
+
+CowArray::CowArray(const CowArray& other) : table(other.table), currentSize(other.currentSize) {}
+
+CowArray::CowArray(CowArray&& other) noexcept
+    : table(std::move(other.table)), currentSize(other.currentSize) {
+    other.currentSize = 0;
+}
+
+CowArray& CowArray::operator=(const CowArray& other) {
+    if (this != &other) {
+        table = other.table;
+        currentSize = other.currentSize;
+    }
+    return *this;
+}
+
+CowArray& CowArray::operator=(CowArray&& other) noexcept {
+    if (this != &other) {
+        table = std::move(other.table);
+        currentSize = other.currentSize;
+        other.currentSize = 0;
+    }
+    return *this;
+}
+
+CowArray::~CowArray() {}
+
+CowArray CowArray::snapshot() const {
+    return *this;
+}
+
+const std::string& CowArray::slot(size_t index) const {
+    return table->chunks[index >> CHUNK_SHIFT]->items[index & (CHUNK_SIZE - 1)];
+}
+
+void CowArray::detachTable() {
+    if (!table) {
+        table = std::make_shared<Table>();
+    } else if (table.use_count() != 1) {
+        table = std::make_shared<Table>(*table);
+    } else {
+        // Другой владелец мог только что отпустить таблицу из своего потока:
+        // его чтения должны завершиться до нашей записи
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+}
+
+std::string& CowArray::mutableSlot(size_t index) {
+    detachTable();
+    std::shared_ptr<Chunk>& chunk = table->chunks[index >> CHUNK_SHIFT];
+    if (chunk.use_count() != 1) {
+        chunk = std::make_shared<Chunk>(*chunk);
+    } else {
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    return chunk->items[index & (CHUNK_SIZE - 1)];
+}
+
+void CowArray::openSlot(size_t index) {
+    if (index > currentSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    
+    detachTable();
+    if (currentSize == table->chunks.size() * CHUNK_SIZE) {
+        table->chunks.push_back(std::make_shared<Chunk>());
+    }
+    for (size_t i = currentSize; i > index; --i) {
+        mutableSlot(i) = std::move(mutableSlot(i - 1));
+    }
+    currentSize++;
+}
+
+void CowArray::insert(const std::string& value) {
+    insertAt(currentSize, value);
+}
+
+void CowArray::insert(std::string&& value) {
+    insertAt(currentSize, std::move(value));
+}
+
+void CowArray::insertAt(size_t index, const std::string& value) {
+    openSlot(index);
+    mutableSlot(index) = value;
+}
+
+void CowArray::insertAt(size_t index, std::string&& value) {
+    openSlot(index);
+    mutableSlot(index) = std::move(value);
+}
+
+void CowArray::remove(size_t index) {
+    if (index >= currentSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    
+    for (size_t i = index; i + 1 < currentSize; ++i) {
+        mutableSlot(i) = std::move(mutableSlot(i + 1));
+    }
+    currentSize--;
+    
+    // Освобождаем опустевший блок или строку в последнем слоте
+    if (currentSize % CHUNK_SIZE == 0) {
+        detachTable();
+        table->chunks.pop_back();
+    } else {
+        mutableSlot(currentSize) = std::string();
+    }
+}
+
+std::string CowArray::get(size_t index) const {
+    return at(index);
+}
+
+const std::string& CowArray::at(size_t index) const {
+    if (index >= currentSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    return slot(index);
+}
+
+void CowArray::set(size_t index, const std::string& value) {
+    if (index >= currentSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    mutableSlot(index) = value;
+}
+
+void CowArray::set(size_t index, std::string&& value) {
+    if (index >= currentSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    mutableSlot(index) = std::move(value);
+}
+
+size_t CowArray::size() const {
+    return currentSize;
+}
+
+bool CowArray::empty() const {
+    return currentSize == 0;
+}
+
+void CowArray::clear() {
+    table.reset();
+    currentSize = 0;
+}
+
+void CowArray::print() const {
+    std::cout << "[";
+    for (size_t i = 0; i < currentSize; ++i) {
+        std::cout << "\"" << slot(i) << "\"";
+        if (i < currentSize - 1) std::cout << ", ";
+    }
+    std::cout << "]" << std::endl;
+}
+
+void CowArray::serialize(std::ostream& os) const {
+    os.write(reinterpret_cast<const char*>(&currentSize), sizeof(currentSize));
+    for (size_t i = 0; i < currentSize; ++i) {
+        const std::string& value = slot(i);
+        size_t strLen = value.length();
+        os.write(reinterpret_cast<const char*>(&strLen), sizeof(strLen));
+        os.write(value.c_str(), strLen);
+    }
+}
+
+void CowArray::deserialize(std::istream& is) {
+    size_t arrSize;
+    is.read(reinterpret_cast<char*>(&arrSize), sizeof(arrSize));
+    
+    clear();
+    for (size_t i = 0; i < arrSize; ++i) {
+        size_t strLen;
+        is.read(reinterpret_cast<char*>(&strLen), sizeof(strLen));
+        std::string value(strLen, ' ');
+        is.read(&value[0], strLen);
+        insert(std::move(value));
+    }
+}
+
+// Текстовая сериализация
+void CowArray::serializeText(std::ostream& os) const {
+    os << currentSize << "\n";
+    for (size_t i = 0; i < currentSize; ++i) {
+        // Экранируем специальные символы
+        std::string escaped = slot(i);
+        size_t pos = 0;
+        while ((pos = escaped.find('\n', pos)) != std::string::npos) {
+            escaped.replace(pos, 1, "\\n");
+            pos += 2;
+        }
+        pos = 0;
+        while ((pos = escaped.find('\"', pos)) != std::string::npos) {
+            escaped.replace(pos, 1, "\\\"");
+            pos += 2;
+        }
+        os << "\"" << escaped << "\"\n";
+    }
+}
+
+// Текстовая десериализация
+void CowArray::deserializeText(std::istream& is) {
+    size_t newSize;
+    is >> newSize;
+    is.get(); // Пропускаем перевод строки
+    
+    clear();
+    
+    for (size_t i = 0; i < newSize; ++i) {
+        std::string line;
+        std::getline(is, line);
+        
+        // Убираем обрамляющие кавычки и разэкранируем
+        if (line.size() >= 2 && line.front() == '\"' && line.back() == '\"') {
+            line = line.substr(1, line.size() - 2);
+            
+            size_t pos = 0;
+            while ((pos = line.find("\\n", pos)) != std::string::npos) {
+                line.replace(pos, 2, "\n");
+                pos += 1;
+            }
+            pos = 0;
+            while ((pos = line.find("\\\"", pos)) != std::string::npos) {
+                line.replace(pos, 2, "\"");
+                pos += 1;
+            }
+        }
+        
+        insert(std::move(line));
+    }
+}
@@ -0,0 +1,76 @@
+#ifndef COWARRAY_H
+#define COWARRAY_H
+
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Массив строк с копированием при записи. Элементы лежат в блоках по
+// CHUNK_SIZE штук, таблица блоков и сами блоки разделяются через shared_ptr.
+// Копия (snapshot) создается за O(1); при изменении копируется только таблица
+// и тот блок, в который идет запись, остальные блоки остаются общими.
+// Снимок можно читать (например, сериализовать) в другом потоке, пока
+// владелец продолжает изменять исходный массив.
+// Интерфейс и формат сериализации совпадают с Array.
+class CowArray {
+private:
+    static const size_t CHUNK_SHIFT = 6;
+    static const size_t CHUNK_SIZE = static_cast<size_t>(1) << CHUNK_SHIFT;
+    
+    struct Chunk {
+        std::string items[CHUNK_SIZE];
+    };
+    
+    struct Table {
+        std::vector<std::shared_ptr<Chunk>> chunks;
+    };
+    
+    std::shared_ptr<Table> table;
+    size_t currentSize;
+    
+    const std::string& slot(size_t index) const;
+    // Делает таблицу и блок с элементом index собственными и возвращает слот
+    std::string& mutableSlot(size_t index);
+    void detachTable();
+    void openSlot(size_t index);
+
+public:
+    CowArray();
+    // Копирование и присваивание разделяют данные, O(1)
+    CowArray(const CowArray& other);
+    CowArray(CowArray&& other) noexcept;
+    CowArray& operator=(const CowArray& other);
+    CowArray& operator=(CowArray&& other) noexcept;
+    ~CowArray();
+    
+    // Согласованный снимок текущего содержимого, O(1)
+    CowArray snapshot() const;
+    
+    void insert(const std::string& value);
+    void insert(std::string&& value);
+    void insertAt(size_t index, const std::string& value);
+    void insertAt(size_t index, std::string&& value);
+    void remove(size_t index);
+    std::string get(size_t index) const;
+    // Ссылка действительна до следующего изменения этого массива
+    const std::string& at(size_t index) const;
+    void set(size_t index, const std::string& value);
+    void set(size_t index, std::string&& value);
+    size_t size() const;
+    bool empty() const;
+    
+    void clear();
+    void print() const;
+    
+    // Бинарная сериализация (совместима с Array)
+    void serialize(std::ostream& os) const;
+    void deserialize(std::istream& is);
+    
+    // Текстовая сериализация
+    void serializeText(std::ostream& os) const;
+    void deserializeText(std::istream& is);
+};
+
+#endif
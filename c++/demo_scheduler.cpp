@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+#include "workstealingdeque.h"
+
+using namespace std;
+
+// Планировщик с деком на каждый поток: задача - полуинтервал чисел, который
+// воркер делит пополам, пока он крупнее GRAIN, правую половину кладет к себе
+// в дек, левую продолжает сам. Вся работа стартует в деке воркера 0,
+// остальные получают ее только кражей.
+
+struct Range {
+    uint32_t begin;
+    uint32_t end;
+};
+
+static const uint32_t GRAIN = 256;
+
+struct Worker {
+    WorkStealingDeque<Range> deque;
+    size_t executed = 0;
+    size_t steals = 0;
+    size_t failedSteals = 0;
+    uint64_t sum = 0;
+};
+
+class Scheduler {
+private:
+    vector<unique_ptr<Worker>> workers;
+    atomic<size_t> pendingItems;
+    
+    // Полезная работа над одним числом: немного арифметики, чтобы задача не была пустой
+    static uint64_t work(uint32_t value) {
+        uint64_t x = value;
+        for (int i = 0; i < 32; i++) {
+            x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        }
+        return (x >> 33) % 1000;
+    }
+    
+    bool findTask(size_t self, Range& task, mt19937& rng) {
+        Worker& me = *workers[self];
+        if (me.deque.pop(task)) {
+            return true;
+        }
+        // Жертву выбираем случайно, чтобы воры не толпились у одного дека
+        for (size_t attempt = 0; attempt < workers.size(); attempt++) {
+            size_t victim = rng() % workers.size();
+            if (victim == self) {
+                continue;
+            }
+            if (workers[victim]->deque.steal(task)) {
+                me.steals++;
+                return true;
+            }
+            me.failedSteals++;
+        }
+        return false;
+    }
+    
+    void run(size_t self) {
+        Worker& me = *workers[self];
+        mt19937 rng(static_cast<unsigned>(self) + 1);
+        Range task;
+        while (pendingItems.load(memory_order_acquire) > 0) {
+            if (!findTask(self, task, rng)) {
+                this_thread::yield();
+                continue;
+            }
+            while (task.end - task.begin > GRAIN) {
+                uint32_t middle = task.begin + (task.end - task.begin) / 2;
+                me.deque.push(Range{middle, task.end});
+                task.end = middle;
+            }
+            for (uint32_t value = task.begin; value < task.end; value++) {
+                me.sum += work(value);
+            }
+            me.executed += task.end - task.begin;
+            pendingItems.fetch_sub(task.end - task.begin, memory_order_acq_rel);
+        }
+    }
+
+public:
+    explicit Scheduler(size_t threadCount) : workers(), pendingItems(0) {
+        for (size_t i = 0; i < threadCount; i++) {
+            workers.push_back(make_unique<Worker>());
+        }
+    }
+    
+    void execute(uint32_t items) {
+        pendingItems.store(items);
+        workers[0]->deque.push(Range{0, items});
+        
+        vector<thread> threads;
+        for (size_t i = 1; i < workers.size(); i++) {
+            threads.emplace_back(&Scheduler::run, this, i);
+        }
+        run(0);
+        for (auto& worker : threads) {
+            worker.join();
+        }
+    }
+    
+    void report(uint32_t items) const {
+        uint64_t total = 0;
+        for (size_t i = 0; i < workers.size(); i++) {
+            const Worker& worker = *workers[i];
+            total += worker.sum;
+            cout << "Worker " << i << ": " << worker.executed << " items ("
+                 << 100.0 * worker.executed / items << "%), steals " << worker.steals
+                 << ", failed steal attempts " << worker.failedSteals << endl;
+        }
+        
+        uint64_t expected = 0;
+        for (uint32_t value = 0; value < items; value++) {
+            expected += work(value);
+        }
+        cout << "Checksum: " << total << (total == expected ? " ✅" : " ❌ expected " + to_string(expected)) << endl;
+    }
+};
+
+int main(int argc, char* argv[]) {
+    size_t threadCount = max<size_t>(2, thread::hardware_concurrency());
+    uint32_t items = 1 << 20;
+    if (argc > 1) {
+        threadCount = max(1, atoi(argv[1]));
+    }
+    if (argc > 2) {
+        items = static_cast<uint32_t>(max(1, atoi(argv[2])));
+    }
+    
+    cout << "=== Work-Stealing Scheduler Demo ===" << endl;
+    cout << threadCount << " worker(s), " << items << " items, grain " << GRAIN << endl;
+    
+    Scheduler scheduler(threadCount);
+    auto start = chrono::high_resolution_clock::now();
+    scheduler.execute(items);
+    auto end = chrono::high_resolution_clock::now();
+    
+    scheduler.report(items);
+    cout << "Time: " << chrono::duration_cast<chrono::milliseconds>(end - start).count() << " ms" << endl;
+    return 0;
+}
@@ -1,6 +1,7 @@
 #include <iostream>
 #include <fstream>
 #include "array.h"
+#include "mappedarray.h"
 #include "singlylinkedlist.h"
 #include "doublylinkedlist.h"
 #include "queue.h"
@@ -43,6 +44,23 @@ void demonstrateArraySerialization() {
     cout << endl;
 }
 
+void demonstrateMappedArray() {
+    cout << "=== Mapped Array Demo ===" << endl;
+    
+    Array arr;
+    arr.insert("Mapped");
+    arr.insert("without");
+    arr.insert("copying");
+    
+    SerializationUtils::saveToMappedFile(arr, "array_mapped.bin");
+    
+    MappedArray mapped("array_mapped.bin");
+    cout << "Array from mapped file: ";
+    mapped.print();
+    
+    cout << endl;
+}
+
 void demonstrateLinkedListSerialization() {
     cout << "=== Linked List Serialization Demo ===" << endl;
     
@@ -266,6 +284,7 @@ int main() {
     cout << "==================================" << endl;
     
     demonstrateArraySerialization();
+    demonstrateMappedArray();
     demonstrateLinkedListSerialization();
     demonstrateHashTableSerialization();
     demonstrateTreeSerialization();
@@ -274,7 +293,7 @@ int main() {
     
     cout << "Demo completed successfully!" << endl;
     cout << "Check generated files:" << endl;
-    cout << "- array_text.txt, array_binary.bin" << endl;
+    cout << "- array_text.txt, array_binary.bin, array_mapped.bin" << endl;
     cout << "- list_text.txt, list_binary.bin" << endl;
     cout << "- hashtable_text.txt, hashtable_binary.bin" << endl;
     cout << "- tree_text.txt, tree_binary.bin" << endl;
@@ -3,13 +3,21 @@
 #include <sstream>
 #include <algorithm>
 
-DoublyLinkedList::DoublyLinkedList() : head(nullptr), tail(nullptr), listSize(0) {}
+DoublyLinkedList::DoublyLinkedList()
+    : pool(std::make_shared<SharedPool>()), head(nullptr), tail(nullptr), listSize(0),
+      cursor(nullptr), cursorIndex(0) {}
+
+DoublyLinkedList::DoublyLinkedList(std::shared_ptr<SharedPool> sharedPool)
+    : pool(std::move(sharedPool)), head(nullptr), tail(nullptr), listSize(0),
+      cursor(nullptr), cursorIndex(0) {}
 
 DoublyLinkedList::~DoublyLinkedList() {
     clear();
 }
 
-DoublyLinkedList::DoublyLinkedList(const DoublyLinkedList& other) : head(nullptr), tail(nullptr), listSize(0) {
+DoublyLinkedList::DoublyLinkedList(const DoublyLinkedList& other)
+    : pool(std::make_shared<SharedPool>()), head(nullptr), tail(nullptr), listSize(0),
+      cursor(nullptr), cursorIndex(0) {
     Node* current = other.head;
     while (current != nullptr) {
         push_back(current->data);
@@ -17,6 +25,15 @@ DoublyLinkedList::DoublyLinkedList(const DoublyLinkedList& other) : head(nullptr
     }
 }
 
+// Пул уходит вместе с узлами; перемещенный список пуст и заведет свой пул сам
+DoublyLinkedList::DoublyLinkedList(DoublyLinkedList&& other) noexcept
+    : pool(std::move(other.pool)), head(other.head), tail(other.tail), listSize(other.listSize),
+      cursor(nullptr), cursorIndex(0) {
+    other.head = other.tail = nullptr;
+    other.listSize = 0;
+    other.resetCursor();
+}
+
 DoublyLinkedList& DoublyLinkedList::operator=(const DoublyLinkedList& other) {
     if (this != &other) {
         clear();
@@ -30,7 +47,7 @@ DoublyLinkedList& DoublyLinkedList::operator=(const DoublyLinkedList& other) {
 }
 
 void DoublyLinkedList::push_front(const std::string& value) {
-    Node* newNode = new Node(value);
+    Node* newNode = nodes().create(value);
     
     if (empty()) {
         head = tail = newNode;
@@ -40,10 +57,13 @@ void DoublyLinkedList::push_front(const std::string& value) {
         head = newNode;
     }
     listSize++;
+    if (cursor != nullptr) {
+        cursorIndex++;
+    }
 }
 
 void DoublyLinkedList::push_back(const std::string& value) {
-    Node* newNode = new Node(value);
+    Node* newNode = nodes().create(value);
     
     if (empty()) {
         head = tail = newNode;
@@ -69,7 +89,12 @@ void DoublyLinkedList::pop_front() {
         tail = nullptr; // Список стал пустым
     }
     
-    delete temp;
+    if (cursor == temp) {
+        resetCursor();
+    } else if (cursor != nullptr) {
+        cursorIndex--;
+    }
+    nodes().destroy(temp);
     listSize--;
 }
 
@@ -87,7 +112,10 @@ void DoublyLinkedList::pop_back() {
         head = nullptr; // Список стал пустым
     }
     
-    delete temp;
+    if (cursor == temp) {
+        resetCursor();
+    }
+    nodes().destroy(temp);
     listSize--;
 }
 
@@ -101,18 +129,18 @@ void DoublyLinkedList::insert(size_t index, const std::string& value) {
     } else if (index == listSize) {
         push_back(value);
     } else {
-        Node* current = head;
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next;
-        }
+        Node* current = nodeAt(index);
         
-        Node* newNode = new Node(value);
+        Node* newNode = nodes().create(value);
         newNode->prev = current->prev;
         newNode->next = current;
         current->prev->next = newNode;
         current->prev = newNode;
         
         listSize++;
+        // Индексы после вставки сдвинулись; курсор встает на новый узел
+        cursor = newNode;
+        cursorIndex = index;
     }
 }
 
@@ -126,15 +154,14 @@ void DoublyLinkedList::remove(size_t index) {
     } else if (index == listSize - 1) {
         pop_back();
     } else {
-        Node* current = head;
-        for (size_t i = 0; i < index; ++i) {
-            current = current->next;
-        }
+        Node* current = nodeAt(index);
         
         current->prev->next = current->next;
         current->next->prev = current->prev;
         
-        delete current;
+        cursor = current->prev;
+        cursorIndex = index - 1;
+        nodes().destroy(current);
         listSize--;
     }
 }
@@ -144,11 +171,42 @@ std::string DoublyLinkedList::get(size_t index) const {
         throw std::out_of_range("Index out of range");
     }
     
+    return nodeAt(index)->data;
+}
+
+DoublyLinkedList::Node* DoublyLinkedList::nodeAt(size_t index) const {
+    // Стартуем с ближайшей из трех точек: голова, хвост или курсор
     Node* current = head;
-    for (size_t i = 0; i < index; ++i) {
+    size_t position = 0;
+    size_t distance = index;
+    if (listSize - 1 - index < distance) {
+        current = tail;
+        position = listSize - 1;
+        distance = listSize - 1 - index;
+    }
+    if (cursor != nullptr) {
+        size_t cursorDistance = (index >= cursorIndex) ? index - cursorIndex : cursorIndex - index;
+        if (cursorDistance < distance) {
+            current = cursor;
+            position = cursorIndex;
+        }
+    }
+    while (position < index) {
         current = current->next;
+        position++;
+    }
+    while (position > index) {
+        current = current->prev;
+        position--;
     }
-    return current->data;
+    cursor = current;
+    cursorIndex = index;
+    return current;
+}
+
+void DoublyLinkedList::resetCursor() const {
+    cursor = nullptr;
+    cursorIndex = 0;
 }
 
 size_t DoublyLinkedList::size() const {
@@ -163,10 +221,16 @@ void DoublyLinkedList::clear() {
     while (head != nullptr) {
         Node* temp = head;
         head = head->next;
-        delete temp;
+        nodes().destroy(temp);
+    }
+    // Блоки общего пула еще держат узлы других списков; ссылки из слитых
+    // пулов тоже считаются, пока их списки не переключились
+    if (pool != nullptr && currentPool().use_count() == 1) {
+        pool->nodes.releaseAll();
     }
     tail = nullptr;
     listSize = 0;
+    resetCursor();
 }
 
 void DoublyLinkedList::print() const {
@@ -302,3 +366,184 @@ std::vector<std::string> DoublyLinkedList::toVector() const {
     }
     return result;
 }
+
+bool DoublyLinkedList::contains(const std::string& value) const {
+    Node* current = head;
+    while (current != nullptr) {
+        if (current->data == value) {
+            return true;
+        }
+        current = current->next;
+    }
+    return false;
+}
+
+std::shared_ptr<DoublyLinkedList::SharedPool>& DoublyLinkedList::currentPool() {
+    if (pool == nullptr) {
+        pool = std::make_shared<SharedPool>();
+    }
+    while (pool->mergedInto != nullptr) {
+        pool = pool->mergedInto;
+    }
+    return pool;
+}
+
+NodePool<DoublyLinkedList::Node>& DoublyLinkedList::nodes() {
+    return currentPool()->nodes;
+}
+
+void DoublyLinkedList::sharePoolWith(DoublyLinkedList& other) {
+    std::shared_ptr<SharedPool>& mine = currentPool();
+    std::shared_ptr<SharedPool>& theirs = other.currentPool();
+    if (mine == theirs) {
+        return;
+    }
+    mine->nodes.absorb(theirs->nodes);
+    theirs->mergedInto = mine;
+    theirs = mine;
+}
+
+void DoublyLinkedList::splice(size_t index, DoublyLinkedList& other) {
+    if (&other == this) {
+        throw std::invalid_argument("Cannot splice a list into itself");
+    }
+    if (index > listSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    if (other.empty()) {
+        return;
+    }
+    
+    Node* first = other.head;
+    Node* last = other.tail;
+    size_t moved = other.listSize;
+    sharePoolWith(other);
+    
+    if (index == listSize) {
+        first->prev = tail;
+        if (tail != nullptr) {
+            tail->next = first;
+        } else {
+            head = first;
+        }
+        tail = last;
+    } else {
+        Node* at = nodeAt(index);
+        first->prev = at->prev;
+        if (at->prev != nullptr) {
+            at->prev->next = first;
+        } else {
+            head = first;
+        }
+        last->next = at;
+        at->prev = last;
+    }
+    listSize += moved;
+    resetCursor();
+    
+    other.head = other.tail = nullptr;
+    other.listSize = 0;
+    other.resetCursor();
+}
+
+void DoublyLinkedList::concat(DoublyLinkedList& other) {
+    splice(listSize, other);
+}
+
+DoublyLinkedList DoublyLinkedList::splitAt(size_t index) {
+    if (index > listSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    
+    DoublyLinkedList result(currentPool());
+    if (index == listSize) {
+        return result;
+    }
+    
+    Node* first = nodeAt(index);
+    result.head = first;
+    result.tail = tail;
+    result.listSize = listSize - index;
+    
+    tail = first->prev;
+    if (tail != nullptr) {
+        tail->next = nullptr;
+    } else {
+        head = nullptr;
+    }
+    first->prev = nullptr;
+    listSize = index;
+    resetCursor();
+    return result;
+}
+
+template<typename Less>
+void DoublyLinkedList::mergeSort(Less less) {
+    if (listSize < 2) {
+        return;
+    }
+    
+    // На каждом проходе сливаем соседние отсортированные отрезки длины width,
+    // заново выстраивая next и prev
+    Node* list = head;
+    for (size_t width = 1; ; width *= 2) {
+        Node* left = list;
+        Node* last = nullptr;
+        size_t merges = 0;
+        list = nullptr;
+        
+        while (left != nullptr) {
+            merges++;
+            Node* right = left;
+            size_t leftSize = 0;
+            while (leftSize < width && right != nullptr) {
+                leftSize++;
+                right = right->next;
+            }
+            size_t rightSize = width;
+            
+            while (leftSize > 0 || (rightSize > 0 && right != nullptr)) {
+                Node* next;
+                // При равенстве берем из левого отрезка - сортировка устойчива
+                if (leftSize == 0) {
+                    next = right;
+                    right = right->next;
+                    rightSize--;
+                } else if (rightSize == 0 || right == nullptr || !less(right->data, left->data)) {
+                    next = left;
+                    left = left->next;
+                    leftSize--;
+                } else {
+                    next = right;
+                    right = right->next;
+                    rightSize--;
+                }
+                
+                if (last != nullptr) {
+                    last->next = next;
+                } else {
+                    list = next;
+                }
+                next->prev = last;
+                last = next;
+            }
+            left = right;
+        }
+        last->next = nullptr;
+        
+        if (merges <= 1) {
+            head = list;
+            tail = last;
+            break;
+        }
+    }
+    resetCursor();
+}
+
+void DoublyLinkedList::sort() {
+    mergeSort(std::less<std::string>());
+}
+
+void DoublyLinkedList::sort(const Comparator& less) {
+    mergeSort(less);
+}
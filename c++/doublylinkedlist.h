@@ -1,8 +1,15 @@
 #ifndef DOUBLYLINKEDLIST_H
 #define DOUBLYLINKEDLIST_H
 
+#include "nodepool.h"
+#include <cstddef>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 class DoublyLinkedList {
@@ -14,14 +21,116 @@ private:
         explicit Node(const std::string& val) : data(val), next(nullptr), prev(nullptr) {}
     };
     
+    // Пул, общий для списков, чьи узлы в нем живут. Когда splice переносит
+    // узлы между разными пулами, блоки одного пула переходят в другой за O(1),
+    // а опустевший пул помнит, куда они ушли: списки, которые еще ссылаются
+    // на него, переключаются на новый пул при следующем обращении.
+    struct SharedPool {
+        NodePool<Node> nodes;
+        std::shared_ptr<SharedPool> mergedInto;
+    };
+    
+    // nullptr у перемещенного списка: новый пул создается при первом обращении
+    std::shared_ptr<SharedPool> pool;
     Node* head;
     Node* tail;
     size_t listSize;
+    
+    // Курсор последнего обращения по индексу: последовательные get(i), get(i + 1)
+    // проходят один узел. Из-за него одновременные чтения из разных потоков
+    // небезопасны даже через const-ссылку.
+    mutable Node* cursor;
+    mutable size_t cursorIndex;
+    
+    Node* nodeAt(size_t index) const;
+    void resetCursor() const;
+    
+    explicit DoublyLinkedList(std::shared_ptr<SharedPool> sharedPool);
+    // Актуальный пул списка (с учетом слияний)
+    std::shared_ptr<SharedPool>& currentPool();
+    NodePool<Node>& nodes();
+    // Делает узлы other узлами нашего пула, сливая пулы при необходимости
+    void sharePoolWith(DoublyLinkedList& other);
+    template<typename Less>
+    void mergeSort(Less less);
 
 public:
+    using Comparator = std::function<bool(const std::string&, const std::string&)>;
+    
+    template<bool IsConst>
+    class Iterator {
+    private:
+        using NodePtr = typename std::conditional<IsConst, const Node*, Node*>::type;
+        using OwnerPtr = typename std::conditional<IsConst, const DoublyLinkedList*, DoublyLinkedList*>::type;
+        
+        NodePtr node;
+        OwnerPtr owner;   // Нужен, чтобы --end() вернул хвост
+        
+        Iterator(NodePtr current, OwnerPtr list) : node(current), owner(list) {}
+        
+        friend class DoublyLinkedList;
+        friend class Iterator<!IsConst>;
+    
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = std::string;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const std::string*, std::string*>::type;
+        using reference = typename std::conditional<IsConst, const std::string&, std::string&>::type;
+        
+        Iterator() : node(nullptr), owner(nullptr) {}
+        
+        // iterator неявно приводится к const_iterator
+        operator Iterator<true>() const {
+            return Iterator<true>(node, owner);
+        }
+        
+        reference operator*() const {
+            return node->data;
+        }
+        
+        pointer operator->() const {
+            return &node->data;
+        }
+        
+        Iterator& operator++() {
+            node = node->next;
+            return *this;
+        }
+        
+        Iterator operator++(int) {
+            Iterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+        
+        Iterator& operator--() {
+            node = (node != nullptr) ? node->prev : owner->tail;
+            return *this;
+        }
+        
+        Iterator operator--(int) {
+            Iterator previous = *this;
+            --(*this);
+            return previous;
+        }
+        
+        bool operator==(const Iterator& other) const {
+            return node == other.node;
+        }
+        
+        bool operator!=(const Iterator& other) const {
+            return node != other.node;
+        }
+    };
+    
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    
     DoublyLinkedList();
     ~DoublyLinkedList();
     DoublyLinkedList(const DoublyLinkedList& other);
+    DoublyLinkedList(DoublyLinkedList&& other) noexcept;
     DoublyLinkedList& operator=(const DoublyLinkedList& other);
     
     void push_front(const std::string& value);
@@ -34,9 +143,40 @@ public:
     size_t size() const;
     bool empty() const;
     
+    iterator begin() { return iterator(head, this); }
+    iterator end() { return iterator(nullptr, this); }
+    const_iterator begin() const { return const_iterator(head, this); }
+    const_iterator end() const { return const_iterator(nullptr, this); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    
+    // Обход всех элементов по порядку без копирования
+    template<typename Visitor>
+    void forEach(Visitor&& visit) const {
+        for (const Node* current = head; current != nullptr; current = current->next) {
+            visit(current->data);
+        }
+    }
+    
+    // Перенос узлов без копирования: splice вставляет все элементы other перед
+    // позицией index, concat - в конец, other становится пустым. splitAt
+    // отрезает элементы начиная с index в новый список. Все три за O(1) плюс
+    // поиск позиции, но после них списки делят один пул узлов: такие списки
+    // (и все, с кем они потом соединялись) нельзя менять из разных потоков
+    // одновременно.
+    void splice(size_t index, DoublyLinkedList& other);
+    void concat(DoublyLinkedList& other);
+    DoublyLinkedList splitAt(size_t index);
+    
+    // Устойчивая сортировка слиянием снизу вверх: узлы только перевязываются,
+    // дополнительной памяти нет. Компаратор не должен бросать исключений.
+    void sort();
+    void sort(const Comparator& less);
+    
     // Новые методы для тестирования
     bool checkIntegrity() const;
     std::vector<std::string> toVector() const;
+    bool contains(const std::string& value) const;
     
     void clear();
     void print() const;
@@ -0,0 +1,434 @@
+#include "indexedlist.h"
+#include <new>
+#include <unordered_map>
+
+IndexedList::IndexedList()
+    : header(createNode("", MAX_LEVEL)), listSize(0), levelCount(1), rng(17) {
+    for (size_t l = 0; l < MAX_LEVEL; ++l) {
+        tails[l] = header;
+        tailRanks[l] = 0;
+    }
+}
+
+IndexedList::~IndexedList() {
+    clear();
+    destroyNode(header);
+}
+
+IndexedList::IndexedList(const IndexedList& other) : IndexedList() {
+    *this = other;
+}
+
+IndexedList& IndexedList::operator=(const IndexedList& other) {
+    if (this != &other) {
+        clear();
+        other.forEach([this](const std::string& value) { push_back(value); });
+    }
+    return *this;
+}
+
+IndexedList::Node* IndexedList::createNode(const std::string& value, size_t height) {
+    void* memory = ::operator new(sizeof(Node) + height * sizeof(Level));
+    Node* node;
+    try {
+        node = new (memory) Node(value, height);
+    } catch (...) {
+        ::operator delete(memory);
+        throw;
+    }
+    for (size_t l = 0; l < height; ++l) {
+        node->levels()[l] = Level{nullptr, nullptr, 0};
+    }
+    return node;
+}
+
+void IndexedList::destroyNode(Node* node) {
+    node->~Node();
+    ::operator delete(node);
+}
+
+size_t IndexedList::randomHeight() {
+    // Вероятность подняться на уровень выше - 1/4
+    size_t height = 1;
+    while (height < MAX_LEVEL && (rng() & 3) == 0) {
+        height++;
+    }
+    return height;
+}
+
+void IndexedList::findPredecessors(size_t position, Node** update, size_t* rank) const {
+    // На каждом уровне - последний узел с позицией меньше position
+    Node* current = header;
+    size_t currentRank = 0;
+    for (size_t l = levelCount; l-- > 0;) {
+        while (current->levels()[l].next != nullptr && currentRank + current->levels()[l].span < position) {
+            currentRank += current->levels()[l].span;
+            current = current->levels()[l].next;
+        }
+        update[l] = current;
+        rank[l] = currentRank;
+    }
+}
+
+void IndexedList::linkNode(Node* node, size_t position, Node** update, size_t* rank) {
+    for (size_t l = levelCount; l < node->height; ++l) {
+        update[l] = header;
+        rank[l] = 0;
+    }
+    if (node->height > levelCount) {
+        levelCount = node->height;
+    }
+    
+    for (size_t l = 0; l < node->height; ++l) {
+        Level& before = update[l]->levels()[l];
+        Level& own = node->levels()[l];
+        own.next = before.next;
+        own.prev = update[l];
+        if (own.next != nullptr) {
+            own.span = rank[l] + before.span + 1 - position;
+            own.next->levels()[l].prev = node;
+        } else {
+            own.span = 0;
+            tails[l] = node;
+            tailRanks[l] = position;
+        }
+        before.next = node;
+        before.span = position - rank[l];
+    }
+    listSize++;
+}
+
+void IndexedList::unlinkNode(Node* node, Node** update, size_t* rank) {
+    for (size_t l = 0; l < node->height; ++l) {
+        Level& before = update[l]->levels()[l];
+        const Level& own = node->levels()[l];
+        before.next = own.next;
+        if (own.next != nullptr) {
+            before.span += own.span - 1;
+            own.next->levels()[l].prev = update[l];
+        } else {
+            before.span = 0;
+            tails[l] = update[l];
+            tailRanks[l] = rank[l];
+        }
+    }
+    listSize--;
+}
+
+void IndexedList::shiftAfter(Node* node, size_t position, Node** update, bool inserted) {
+    for (size_t l = node->height; l < levelCount; ++l) {
+        Level& before = update[l]->levels()[l];
+        if (before.next != nullptr) {
+            before.span = inserted ? before.span + 1 : before.span - 1;
+        }
+    }
+    for (size_t l = 0; l < levelCount; ++l) {
+        if (tails[l] == node) {
+            continue;
+        }
+        if (inserted && tailRanks[l] >= position) {
+            tailRanks[l]++;
+        } else if (!inserted && tailRanks[l] > position) {
+            tailRanks[l]--;
+        }
+    }
+}
+
+void IndexedList::trimLevels() {
+    while (levelCount > 1 && header->levels()[levelCount - 1].next == nullptr) {
+        levelCount--;
+    }
+}
+
+IndexedList::Node* IndexedList::nodeAt(size_t index) const {
+    size_t position = index + 1;
+    Node* current = header;
+    size_t currentRank = 0;
+    for (size_t l = levelCount; l-- > 0;) {
+        while (current->levels()[l].next != nullptr && currentRank + current->levels()[l].span <= position) {
+            currentRank += current->levels()[l].span;
+            current = current->levels()[l].next;
+        }
+        if (currentRank == position) {
+            break;
+        }
+    }
+    return current;
+}
+
+IndexedList::Node* IndexedList::lastNode() const {
+    return (listSize == 0) ? nullptr : tails[0];
+}
+
+void IndexedList::push_front(const std::string& value) {
+    Node* update[MAX_LEVEL];
+    size_t rank[MAX_LEVEL];
+    for (size_t l = 0; l < levelCount; ++l) {
+        update[l] = header;
+        rank[l] = 0;
+    }
+    Node* node = createNode(value, randomHeight());
+    linkNode(node, 1, update, rank);
+    shiftAfter(node, 1, update, true);
+}
+
+void IndexedList::push_back(const std::string& value) {
+    // Предшественники в конце - хвосты уровней, правка выше узла не нужна
+    Node* update[MAX_LEVEL];
+    size_t rank[MAX_LEVEL];
+    Node* node = createNode(value, randomHeight());
+    for (size_t l = 0; l < node->height && l < levelCount; ++l) {
+        update[l] = tails[l];
+        rank[l] = tailRanks[l];
+    }
+    linkNode(node, listSize + 1, update, rank);
+}
+
+void IndexedList::pop_front() {
+    if (empty()) {
+        throw std::runtime_error("List is empty");
+    }
+    
+    Node* update[MAX_LEVEL];
+    size_t rank[MAX_LEVEL];
+    for (size_t l = 0; l < levelCount; ++l) {
+        update[l] = header;
+        rank[l] = 0;
+    }
+    Node* node = header->levels()[0].next;
+    unlinkNode(node, update, rank);
+    shiftAfter(node, 1, update, false);
+    destroyNode(node);
+    trimLevels();
+}
+
+void IndexedList::pop_back() {
+    if (empty()) {
+        throw std::runtime_error("List is empty");
+    }
+    
+    Node* update[MAX_LEVEL];
+    size_t rank[MAX_LEVEL];
+    Node* node = tails[0];
+    for (size_t l = 0; l < node->height; ++l) {
+        update[l] = node->levels()[l].prev;
+        rank[l] = listSize - update[l]->levels()[l].span;
+    }
+    unlinkNode(node, update, rank);
+    destroyNode(node);
+    trimLevels();
+}
+
+void IndexedList::insert(size_t index, const std::string& value) {
+    if (index > listSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    
+    if (index == listSize) {
+        push_back(value);
+        return;
+    }
+    
+    Node* update[MAX_LEVEL];
+    size_t rank[MAX_LEVEL];
+    size_t position = index + 1;
+    findPredecessors(position, update, rank);
+    Node* node = createNode(value, randomHeight());
+    linkNode(node, position, update, rank);
+    shiftAfter(node, position, update, true);
+}
+
+void IndexedList::remove(size_t index) {
+    if (index >= listSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    
+    if (index == listSize - 1) {
+        pop_back();
+        return;
+    }
+    
+    Node* update[MAX_LEVEL];
+    size_t rank[MAX_LEVEL];
+    size_t position = index + 1;
+    findPredecessors(position, update, rank);
+    Node* node = update[0]->levels()[0].next;
+    unlinkNode(node, update, rank);
+    shiftAfter(node, position, update, false);
+    destroyNode(node);
+    trimLevels();
+}
+
+std::string IndexedList::get(size_t index) const {
+    if (index >= listSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    return nodeAt(index)->data;
+}
+
+void IndexedList::set(size_t index, const std::string& value) {
+    if (index >= listSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    nodeAt(index)->data = value;
+}
+
+size_t IndexedList::size() const {
+    return listSize;
+}
+
+bool IndexedList::empty() const {
+    return listSize == 0;
+}
+
+size_t IndexedList::levels() const {
+    return levelCount;
+}
+
+void IndexedList::clear() {
+    Node* current = header->levels()[0].next;
+    while (current != nullptr) {
+        Node* next = current->levels()[0].next;
+        destroyNode(current);
+        current = next;
+    }
+    for (size_t l = 0; l < MAX_LEVEL; ++l) {
+        header->levels()[l] = Level{nullptr, nullptr, 0};
+        tails[l] = header;
+        tailRanks[l] = 0;
+    }
+    listSize = 0;
+    levelCount = 1;
+}
+
+void IndexedList::print() const {
+    if (empty()) {
+        std::cout << "IndexedList: [empty]" << std::endl;
+        return;
+    }
+    
+    std::cout << "IndexedList: [";
+    size_t printed = 0;
+    forEach([&](const std::string& value) {
+        std::cout << "\"" << value << "\"";
+        if (++printed < listSize) std::cout << " <-> ";
+    });
+    std::cout << "]" << std::endl;
+}
+
+void IndexedList::serialize(std::ostream& os) const {
+    os.write(reinterpret_cast<const char*>(&listSize), sizeof(listSize));
+    forEach([&](const std::string& value) {
+        size_t strLen = value.length();
+        os.write(reinterpret_cast<const char*>(&strLen), sizeof(strLen));
+        os.write(value.c_str(), strLen);
+    });
+}
+
+void IndexedList::deserialize(std::istream& is) {
+    clear();
+    size_t listSizeValue;
+    is.read(reinterpret_cast<char*>(&listSizeValue), sizeof(listSizeValue));
+    
+    for (size_t i = 0; i < listSizeValue; ++i) {
+        size_t strLen;
+        is.read(reinterpret_cast<char*>(&strLen), sizeof(strLen));
+        std::string value(strLen, ' ');
+        is.read(&value[0], strLen);
+        push_back(value);
+    }
+}
+
+void IndexedList::serializeText(std::ostream& os) const {
+    os << listSize << "\n";
+    forEach([&](const std::string& value) {
+        std::string escaped = value;
+        size_t pos = 0;
+        while ((pos = escaped.find('\n', pos)) != std::string::npos) {
+            escaped.replace(pos, 1, "\\n");
+            pos += 2;
+        }
+        pos = 0;
+        while ((pos = escaped.find('\"', pos)) != std::string::npos) {
+            escaped.replace(pos, 1, "\\\"");
+            pos += 2;
+        }
+        os << "\"" << escaped << "\"\n";
+    });
+}
+
+void IndexedList::deserializeText(std::istream& is) {
+    clear();
+    size_t newSize;
+    is >> newSize;
+    is.get();
+    
+    for (size_t i = 0; i < newSize; ++i) {
+        std::string line;
+        std::getline(is, line);
+        
+        if (line.size() >= 2 && line.front() == '\"' && line.back() == '\"') {
+            line = line.substr(1, line.size() - 2);
+            
+            size_t pos = 0;
+            while ((pos = line.find("\\n", pos)) != std::string::npos) {
+                line.replace(pos, 2, "\n");
+                pos += 1;
+            }
+            pos = 0;
+            while ((pos = line.find("\\\"", pos)) != std::string::npos) {
+                line.replace(pos, 2, "\"");
+                pos += 1;
+            }
+        }
+        
+        push_back(line);
+    }
+}
+
+bool IndexedList::checkIntegrity() const {
+    // Позиции узлов по нижнему уровню
+    std::unordered_map<const Node*, size_t> positions;
+    positions[header] = 0;
+    size_t count = 0;
+    for (const Node* current = header->levels()[0].next; current != nullptr;
+         current = current->levels()[0].next) {
+        positions[current] = ++count;
+    }
+    if (count != listSize || levelCount == 0 || levelCount > MAX_LEVEL) {
+        return false;
+    }
+    
+    for (size_t l = 0; l < levelCount; ++l) {
+        const Node* current = header;
+        while (current->levels()[l].next != nullptr) {
+            const Node* next = current->levels()[l].next;
+            if (next->height <= l || next->levels()[l].prev != current ||
+                positions[next] - positions[current] != current->levels()[l].span) {
+                return false;
+            }
+            current = next;
+        }
+        if (tails[l] != current || tailRanks[l] != positions[current]) {
+            return false;
+        }
+    }
+    return levelCount == 1 || header->levels()[levelCount - 1].next != nullptr;
+}
+
+std::vector<std::string> IndexedList::toVector() const {
+    std::vector<std::string> result;
+    result.reserve(listSize);
+    forEach([&](const std::string& value) { result.push_back(value); });
+    return result;
+}
+
+bool IndexedList::contains(const std::string& value) const {
+    for (const Node* current = header->levels()[0].next; current != nullptr;
+         current = current->levels()[0].next) {
+        if (current->data == value) {
+            return true;
+        }
+    }
+    return false;
+}
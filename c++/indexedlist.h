@@ -0,0 +1,191 @@
+#ifndef INDEXEDLIST_H
+#define INDEXEDLIST_H
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Список с индексным слоем: двусвязный список на нижнем уровне плюс
+// skip list с длинами переходов (span) на верхних. get/insert/remove по
+// индексу спускаются по уровням за O(log n) в среднем. Вставка и удаление в
+// конце идут через запомненные хвосты уровней и трогают только уровни самого
+// узла (в среднем O(1)), в начале - еще и счетчики заголовка (O(число уровней)).
+// Интерфейс и формат сериализации совпадают с DoublyLinkedList.
+class IndexedList {
+public:
+    static const size_t MAX_LEVEL = 32;
+
+private:
+    struct Node;
+    
+    struct Level {
+        Node* next;
+        Node* prev;
+        size_t span;   // На сколько позиций вперед ведет next (0, если next нет)
+    };
+    
+    // Уровни лежат в той же памяти сразу за узлом
+    struct Node {
+        std::string data;
+        size_t height;
+        
+        Node(const std::string& value, size_t levelCount) : data(value), height(levelCount) {}
+        
+        Level* levels() {
+            return reinterpret_cast<Level*>(this + 1);
+        }
+        
+        const Level* levels() const {
+            return reinterpret_cast<const Level*>(this + 1);
+        }
+    };
+    
+    // Позиции считаются с 1, у заголовка позиция 0
+    Node* header;
+    size_t listSize;
+    size_t levelCount;
+    Node* tails[MAX_LEVEL];        // Последний узел каждого уровня
+    size_t tailRanks[MAX_LEVEL];   // и его позиция
+    std::minstd_rand rng;
+    
+    static Node* createNode(const std::string& value, size_t height);
+    static void destroyNode(Node* node);
+    size_t randomHeight();
+    
+    void findPredecessors(size_t position, Node** update, size_t* rank) const;
+    void linkNode(Node* node, size_t position, Node** update, size_t* rank);
+    void unlinkNode(Node* node, Node** update, size_t* rank);
+    // Поправка длин переходов над узлом и позиций хвостов после вставки/удаления
+    void shiftAfter(Node* node, size_t position, Node** update, bool inserted);
+    void trimLevels();
+    Node* nodeAt(size_t index) const;
+    Node* lastNode() const;
+
+public:
+    template<bool IsConst>
+    class Iterator {
+    private:
+        using NodePtr = typename std::conditional<IsConst, const Node*, Node*>::type;
+        using OwnerPtr = typename std::conditional<IsConst, const IndexedList*, IndexedList*>::type;
+        
+        NodePtr node;
+        OwnerPtr owner;   // Нужен, чтобы --end() вернул хвост
+        
+        Iterator(NodePtr current, OwnerPtr list) : node(current), owner(list) {}
+        
+        friend class IndexedList;
+        friend class Iterator<!IsConst>;
+    
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = std::string;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const std::string*, std::string*>::type;
+        using reference = typename std::conditional<IsConst, const std::string&, std::string&>::type;
+        
+        Iterator() : node(nullptr), owner(nullptr) {}
+        
+        // iterator неявно приводится к const_iterator
+        operator Iterator<true>() const {
+            return Iterator<true>(node, owner);
+        }
+        
+        reference operator*() const {
+            return node->data;
+        }
+        
+        pointer operator->() const {
+            return &node->data;
+        }
+        
+        Iterator& operator++() {
+            node = node->levels()[0].next;
+            return *this;
+        }
+        
+        Iterator operator++(int) {
+            Iterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+        
+        Iterator& operator--() {
+            node = (node != nullptr) ? node->levels()[0].prev : owner->lastNode();
+            return *this;
+        }
+        
+        Iterator operator--(int) {
+            Iterator previous = *this;
+            --(*this);
+            return previous;
+        }
+        
+        bool operator==(const Iterator& other) const {
+            return node == other.node;
+        }
+        
+        bool operator!=(const Iterator& other) const {
+            return node != other.node;
+        }
+    };
+    
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    
+    IndexedList();
+    ~IndexedList();
+    IndexedList(const IndexedList& other);
+    IndexedList& operator=(const IndexedList& other);
+    
+    void push_front(const std::string& value);
+    void push_back(const std::string& value);
+    void pop_front();
+    void pop_back();
+    void insert(size_t index, const std::string& value);
+    void remove(size_t index);
+    std::string get(size_t index) const;
+    void set(size_t index, const std::string& value);
+    size_t size() const;
+    bool empty() const;
+    
+    // Число используемых уровней (для тестов и бенчмарков)
+    size_t levels() const;
+    
+    iterator begin() { return iterator(header->levels()[0].next, this); }
+    iterator end() { return iterator(nullptr, this); }
+    const_iterator begin() const { return const_iterator(header->levels()[0].next, this); }
+    const_iterator end() const { return const_iterator(nullptr, this); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    
+    template<typename Visitor>
+    void forEach(Visitor&& visit) const {
+        for (const Node* current = header->levels()[0].next; current != nullptr;
+             current = current->levels()[0].next) {
+            visit(current->data);
+        }
+    }
+    
+    // Проверяет связи и длины переходов на всех уровнях
+    bool checkIntegrity() const;
+    std::vector<std::string> toVector() const;
+    bool contains(const std::string& value) const;
+    
+    void clear();
+    void print() const;
+    
+    // Бинарная сериализация (совместима со связными списками)
+    void serialize(std::ostream& os) const;
+    void deserialize(std::istream& is);
+    
+    // Текстовая сериализация
+    void serializeText(std::ostream& os) const;
+    void deserializeText(std::istream& is);
+};
+
+#endif
@@ -1,13 +1,16 @@
 #include "interface.h"
 #include <algorithm>
+#include <iterator>
 
 ConsoleInterface::ConsoleInterface() = default;
 
 ConsoleInterface::~ConsoleInterface() {
     for (const auto& pair : arrays) delete pair.second;
+    for (const auto& pair : sortedArrays) delete pair.second;
     for (const auto& pair : singlyLists) delete pair.second;
     for (const auto& pair : doublyLists) delete pair.second;
     for (const auto& pair : queues) delete pair.second;
+    for (const auto& pair : blockingQueues) delete pair.second;
     for (const auto& pair : stacks) delete pair.second;
     for (const auto& pair : hashTables) delete pair.second;
     for (const auto& pair : trees) delete pair.second;
@@ -77,6 +80,7 @@ void ConsoleInterface::printHelp() {
     std::cout << "Доступные команды:\n";
     std::cout << "Создание контейнеров:\n";
     std::cout << "  MCREATE <name>      - Создать массив\n";
+    std::cout << "  MSCREATE <name>     - Создать упорядоченный массив\n";
     std::cout << "  FCREATE <name>      - Создать односвязный список\n";
     std::cout << "  LCREATE <name>      - Создать двусвязный список\n";
     std::cout << "  QCREATE <name>      - Создать очередь\n";
@@ -89,8 +93,17 @@ void ConsoleInterface::printHelp() {
     std::cout << "  MPUSHINDEX <name> <index> <value> - Вставить элемент по индексу\n";
     std::cout << "  WREPLACE <name> <index> <value>   - Заменить элемент по индексу\n";
     std::cout << "  MDEL <name> <index>           - Удалить элемент по индексу\n";
+    std::cout << "  MSORT <name>                  - Отсортировать массив (многопоточно)\n";
+    std::cout << "  MFIND <name> <pattern>        - Найти элементы, содержащие подстроку\n";
     std::cout << "  MGET <name>                   - Показать массив\n\n";
     
+    std::cout << "Операции с упорядоченным массивом:\n";
+    std::cout << "  MSINSERT <name> <value>       - Вставить с сохранением порядка\n";
+    std::cout << "  MSFIND <name> <value>         - Найти значение (двоичный поиск)\n";
+    std::cout << "  MSRANGE <name> <value>        - Диапазон равных значений\n";
+    std::cout << "  MSDEL <name> <value>          - Удалить одно вхождение значения\n";
+    std::cout << "  MSGET <name>                  - Показать массив\n\n";
+    
     std::cout << "Операции с односвязным списком:\n";
     std::cout << "  FPUSHHEAD <name> <value>      - Добавить в начало\n";
     std::cout << "  FPUSHTAIL <name> <value>      - Добавить в конец\n";
@@ -103,13 +116,22 @@ void ConsoleInterface::printHelp() {
     std::cout << "  LPUSHTAIL <name> <value>      - Добавить в конец\n";
     std::cout << "  LDELHEAD <name>               - Удалить из начала\n";
     std::cout << "  LDELTAIL <name>               - Удалить из конца\n";
+    std::cout << "  LCONCAT <name> <source>       - Перенести source в конец списка\n";
+    std::cout << "  LSORT <name>                  - Отсортировать список\n";
     std::cout << "  LGET <name>                   - Показать список\n\n";
     
     std::cout << "Операции с очередью:\n";
     std::cout << "  QPUSH <name> <value>          - Добавить в очередь\n";
     std::cout << "  QPOP <name>                   - Извлечь из очереди\n";
+    std::cout << "  QPUSHN <name> <v1> [v2 ...]   - Добавить несколько значений\n";
+    std::cout << "  QPOPN <name> <count>          - Извлечь до count значений\n";
     std::cout << "  QGET <name>                   - Показать очередь\n\n";
     
+    std::cout << "Операции с блокирующей очередью:\n";
+    std::cout << "  BQCREATE <name> [capacity]    - Создать (0 - без ограничения)\n";
+    std::cout << "  BQPUSH <name> <value>         - Добавить, если есть место\n";
+    std::cout << "  BQPOP <name> <timeout_ms>     - Извлечь, ожидая до timeout_ms\n\n";
+    
     std::cout << "Операции со стеком:\n";
     std::cout << "  SPUSH <name> <value>          - Добавить в стек\n";
     std::cout << "  SPOP <name>                   - Извлечь из стека\n";
@@ -152,7 +174,7 @@ void ConsoleInterface::executeCommand(const std::vector<std::string>& args) {
             if (args.size() >= 2) {
                 std::string name = args[1];
                 if (arrays.find(name) == arrays.end()) {
-                    arrays[name] = new Array();
+                    arrays[name] = new SmallArray<std::string, 4>();
                     std::cout << "✅ Array '" << name << "' создан" << std::endl;
                 } else {
                     std::cout << "❌ Array '" << name << "' уже существует" << std::endl;
@@ -219,6 +241,36 @@ void ConsoleInterface::executeCommand(const std::vector<std::string>& args) {
                 std::cout << "❌ Использование: MDEL <name> <index>" << std::endl;
             }
         }
+        else if (command == "MSORT") {
+            if (args.size() >= 2) {
+                std::string name = args[1];
+                if (arrays.count(name)) {
+                    arrays[name]->sort();
+                    std::cout << "✅ Array '" << name << "' отсортирован" << std::endl;
+                } else {
+                    std::cout << "❌ Array '" << name << "' не найден" << std::endl;
+                }
+            } else {
+                std::cout << "❌ Использование: MSORT <name>" << std::endl;
+            }
+        }
+        else if (command == "MFIND") {
+            if (args.size() >= 3) {
+                std::string name = args[1];
+                std::string pattern = unescapeString(args[2]);
+                if (arrays.count(name)) {
+                    std::vector<size_t> found = arrays[name]->findAll(pattern);
+                    std::cout << "Найдено в Array '" << name << "': " << found.size() << std::endl;
+                    for (size_t index : found) {
+                        std::cout << "  [" << index << "] \"" << arrays[name]->at(index) << "\"" << std::endl;
+                    }
+                } else {
+                    std::cout << "❌ Array '" << name << "' не найден" << std::endl;
+                }
+            } else {
+                std::cout << "❌ Использование: MFIND <name> <pattern>" << std::endl;
+            }
+        }
         else if (command == "MGET") {
             if (args.size() >= 2) {
                 std::string name = args[1];
@@ -233,6 +285,98 @@ void ConsoleInterface::executeCommand(const std::vector<std::string>& args) {
             }
         }
         
+        // ==================== SORTED ARRAY COMMANDS ====================
+        else if (command == "MSCREATE") {
+            if (args.size() >= 2) {
+                std::string name = args[1];
+                if (sortedArrays.find(name) == sortedArrays.end()) {
+                    sortedArrays[name] = new SortedArray();
+                    std::cout << "✅ SortedArray '" << name << "' создан" << std::endl;
+                } else {
+                    std::cout << "❌ SortedArray '" << name << "' уже существует" << std::endl;
+                }
+            } else {
+                std::cout << "❌ Использование: MSCREATE <name>" << std::endl;
+            }
+        }
+        else if (command == "MSINSERT") {
+            if (args.size() >= 3) {
+                std::string name = args[1];
+                std::string value = unescapeString(args[2]);
+                if (sortedArrays.count(name)) {
+                    size_t pos = sortedArrays[name]->insertSorted(std::move(value));
+                    std::cout << "✅ Значение добавлено в SortedArray '" << name << "' на позицию " << pos << std::endl;
+                } else {
+                    std::cout << "❌ SortedArray '" << name << "' не найден" << std::endl;
+                }
+            } else {
+                std::cout << "❌ Использование: MSINSERT <name> <value>" << std::endl;
+            }
+        }
+        else if (command == "MSFIND") {
+            if (args.size() >= 3) {
+                std::string name = args[1];
+                std::string value = unescapeString(args[2]);
+                if (sortedArrays.count(name)) {
+                    if (sortedArrays[name]->contains(value)) {
+                        std::cout << "✅ Значение найдено в SortedArray '" << name << "' на позиции "
+                                  << sortedArrays[name]->lowerBound(value) << std::endl;
+                    } else {
+                        std::cout << "❌ Значение не найдено в SortedArray '" << name << "'" << std::endl;
+                    }
+                } else {
+                    std::cout << "❌ SortedArray '" << name << "' не найден" << std::endl;
+                }
+            } else {
+                std::cout << "❌ Использование: MSFIND <name> <value>" << std::endl;
+            }
+        }
+        else if (command == "MSRANGE") {
+            if (args.size() >= 3) {
+                std::string name = args[1];
+                std::string value = unescapeString(args[2]);
+                if (sortedArrays.count(name)) {
+                    std::pair<size_t, size_t> range = sortedArrays[name]->equalRange(value);
+                    std::cout << "✅ SortedArray '" << name << "': [" << range.first << ", " << range.second
+                              << "), совпадений: " << range.second - range.first << std::endl;
+                } else {
+                    std::cout << "❌ SortedArray '" << name << "' не найден" << std::endl;
+                }
+            } else {
+                std::cout << "❌ Использование: MSRANGE <name> <value>" << std::endl;
+            }
+        }
+        else if (command == "MSDEL") {
+            if (args.size() >= 3) {
+                std::string name = args[1];
+                std::string value = unescapeString(args[2]);
+                if (sortedArrays.count(name)) {
+                    if (sortedArrays[name]->erase(value)) {
+                        std::cout << "✅ Значение удалено из SortedArray '" << name << "'" << std::endl;
+                    } else {
+                        std::cout << "❌ Значение не найдено в SortedArray '" << name << "'" << std::endl;
+                    }
+                } else {
+                    std::cout << "❌ SortedArray '" << name << "' не найден" << std::endl;
+                }
+            } else {
+                std::cout << "❌ Использование: MSDEL <name> <value>" << std::endl;
+            }
+        }
+        else if (command == "MSGET") {
+            if (args.size() >= 2) {
+                std::string name = args[1];
+                if (sortedArrays.count(name)) {
+                    std::cout << "SortedArray '" << name << "': ";
+                    sortedArrays[name]->print();
+                } else {
+                    std::cout << "❌ SortedArray '" << name << "' не найден" << std::endl;
+                }
+            } else {
+                std::cout << "❌ Использование: MSGET <name>" << std::endl;
+            }
+        }
+        
         // ==================== SINGLY LINKED LIST COMMANDS ====================
         else if (command == "FCREATE") {
             if (args.size() >= 2) {
@@ -396,6 +540,39 @@ void ConsoleInterface::executeCommand(const std::vector<std::string>& args) {
                 std::cout << "❌ Использование: LGET <name>" << std::endl;
             }
         }
+        else if (command == "LCONCAT") {
+            if (args.size() >= 3) {
+                std::string name = args[1];
+                std::string source = args[2];
+                if (!doublyLists.count(name)) {
+                    std::cout << "❌ DoublyLinkedList '" << name << "' не найден" << std::endl;
+                } else if (!doublyLists.count(source)) {
+                    std::cout << "❌ DoublyLinkedList '" << source << "' не найден" << std::endl;
+                } else if (name == source) {
+                    std::cout << "❌ Нельзя присоединить список к самому себе" << std::endl;
+                } else {
+                    size_t moved = doublyLists[source]->size();
+                    doublyLists[name]->concat(*doublyLists[source]);
+                    std::cout << "✅ " << moved << " элементов перенесено из '" << source
+                              << "' в конец DoublyLinkedList '" << name << "'" << std::endl;
+                }
+            } else {
+                std::cout << "❌ Использование: LCONCAT <name> <source>" << std::endl;
+            }
+        }
+        else if (command == "LSORT") {
+            if (args.size() >= 2) {
+                std::string name = args[1];
+                if (doublyLists.count(name)) {
+                    doublyLists[name]->sort();
+                    std::cout << "✅ DoublyLinkedList '" << name << "' отсортирован" << std::endl;
+                } else {
+                    std::cout << "❌ DoublyLinkedList '" << name << "' не найден" << std::endl;
+                }
+            } else {
+                std::cout << "❌ Использование: LSORT <name>" << std::endl;
+            }
+        }
         
         // ==================== QUEUE COMMANDS ====================
         else if (command == "QCREATE") {
@@ -438,6 +615,41 @@ void ConsoleInterface::executeCommand(const std::vector<std::string>& args) {
                 std::cout << "❌ Использование: QPOP <name>" << std::endl;
             }
         }
+        else if (command == "QPUSHN") {
+            if (args.size() >= 3) {
+                std::string name = args[1];
+                if (queues.count(name)) {
+                    std::vector<std::string> values;
+                    for (size_t i = 2; i < args.size(); ++i) {
+                        values.push_back(unescapeString(args[i]));
+                    }
+                    queues[name]->enqueueBatch(values.begin(), values.end());
+                    std::cout << "✅ Добавлено в Queue '" << name << "': " << values.size() << std::endl;
+                } else {
+                    std::cout << "❌ Queue '" << name << "' не найдена" << std::endl;
+                }
+            } else {
+                std::cout << "❌ Использование: QPUSHN <name> <v1> [v2 ...]" << std::endl;
+            }
+        }
+        else if (command == "QPOPN") {
+            int maxCount = (args.size() >= 3) ? stringToInt(args[2]) : 0;
+            if (args.size() >= 3 && maxCount >= 1) {
+                std::string name = args[1];
+                if (queues.count(name)) {
+                    std::vector<std::string> values;
+                    queues[name]->dequeueBatch(std::back_inserter(values), static_cast<size_t>(maxCount));
+                    std::cout << "✅ Извлечено из Queue '" << name << "': " << values.size() << std::endl;
+                    for (const auto& value : values) {
+                        std::cout << "  " << value << std::endl;
+                    }
+                } else {
+                    std::cout << "❌ Queue '" << name << "' не найдена" << std::endl;
+                }
+            } else {
+                std::cout << "❌ Использование: QPOPN <name> <count>" << std::endl;
+            }
+        }
         else if (command == "QGET") {
             if (args.size() >= 2) {
                 std::string name = args[1];
@@ -452,6 +664,61 @@ void ConsoleInterface::executeCommand(const std::vector<std::string>& args) {
             }
         }
         
+        // ==================== BLOCKING QUEUE COMMANDS ====================
+        else if (command == "BQCREATE") {
+            int capacity = (args.size() >= 3) ? stringToInt(args[2]) : 0;
+            if (args.size() >= 2 && capacity >= 0) {
+                std::string name = args[1];
+                if (blockingQueues.find(name) == blockingQueues.end()) {
+                    blockingQueues[name] = new BlockingQueue(static_cast<size_t>(capacity));
+                    std::cout << "✅ BlockingQueue '" << name << "' создана";
+                    if (capacity != 0) {
+                        std::cout << " (емкость " << capacity << ")";
+                    }
+                    std::cout << std::endl;
+                } else {
+                    std::cout << "❌ BlockingQueue '" << name << "' уже существует" << std::endl;
+                }
+            } else {
+                std::cout << "❌ Использование: BQCREATE <name> [capacity]" << std::endl;
+            }
+        }
+        else if (command == "BQPUSH") {
+            if (args.size() >= 3) {
+                std::string name = args[1];
+                std::string value = unescapeString(args[2]);
+                if (blockingQueues.count(name)) {
+                    if (blockingQueues[name]->enqueueWait(std::move(value), std::chrono::milliseconds(0))) {
+                        std::cout << "✅ Значение добавлено в BlockingQueue '" << name << "'" << std::endl;
+                    } else {
+                        std::cout << "❌ BlockingQueue '" << name << "' заполнена" << std::endl;
+                    }
+                } else {
+                    std::cout << "❌ BlockingQueue '" << name << "' не найдена" << std::endl;
+                }
+            } else {
+                std::cout << "❌ Использование: BQPUSH <name> <value>" << std::endl;
+            }
+        }
+        else if (command == "BQPOP") {
+            if (args.size() >= 3) {
+                std::string name = args[1];
+                int timeout = stringToInt(args[2]);
+                if (blockingQueues.count(name)) {
+                    std::string value;
+                    if (blockingQueues[name]->dequeueWait(value, std::chrono::milliseconds(timeout < 0 ? 0 : timeout))) {
+                        std::cout << "✅ Извлечено из BlockingQueue '" << name << "': " << value << std::endl;
+                    } else {
+                        std::cout << "❌ BlockingQueue '" << name << "' пуста (ожидание " << timeout << " мс)" << std::endl;
+                    }
+                } else {
+                    std::cout << "❌ BlockingQueue '" << name << "' не найдена" << std::endl;
+                }
+            } else {
+                std::cout << "❌ Использование: BQPOP <name> <timeout_ms>" << std::endl;
+            }
+        }
+        
         // ==================== STACK COMMANDS ====================
         else if (command == "SCREATE") {
             if (args.size() >= 2) {
@@ -647,6 +914,11 @@ void ConsoleInterface::executeCommand(const std::vector<std::string>& args) {
                     arrays[name]->print();
                     found = true;
                 }
+                if (sortedArrays.count(name)) {
+                    std::cout << "SortedArray '" << name << "': ";
+                    sortedArrays[name]->print();
+                    found = true;
+                }
                 if (singlyLists.count(name)) {
                     std::cout << "SinglyLinkedList '" << name << "': ";
                     singlyLists[name]->print();
@@ -662,6 +934,11 @@ void ConsoleInterface::executeCommand(const std::vector<std::string>& args) {
                     queues[name]->print();
                     found = true;
                 }
+                if (blockingQueues.count(name)) {
+                    std::cout << "BlockingQueue '" << name << "': ";
+                    blockingQueues[name]->print();
+                    found = true;
+                }
                 if (stacks.count(name)) {
                     std::cout << "Stack '" << name << "': ";
                     stacks[name]->print();
@@ -8,9 +8,12 @@
 #include <sstream>
 #include <fstream>
 #include "array.h"
+#include "smallarray.h"
+#include "sortedarray.h"
 #include "singlylinkedlist.h"
 #include "doublylinkedlist.h"
 #include "queue.h"
+#include "blockingqueue.h"
 #include "stack.h"
 #include "hashtable.h"
 #include "tree.h"
@@ -18,10 +21,13 @@
 
 class ConsoleInterface {
 private:
-    std::map<std::string, Array*> arrays;
+    // Консольные массивы обычно из нескольких элементов: до четырех лежат прямо в объекте
+    std::map<std::string, SmallArray<std::string, 4>*> arrays;
+    std::map<std::string, SortedArray*> sortedArrays;
     std::map<std::string, SinglyLinkedList*> singlyLists;
     std::map<std::string, DoublyLinkedList*> doublyLists;
     std::map<std::string, Queue*> queues;
+    std::map<std::string, BlockingQueue*> blockingQueues;
     std::map<std::string, Stack*> stacks;
     std::map<std::string, HashTable*> hashTables;
     std::map<std::string, CompleteBinaryTree*> trees;
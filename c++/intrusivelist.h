@@ -0,0 +1,497 @@
+#ifndef INTRUSIVELIST_H
+#define INTRUSIVELIST_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+// Интрузивные списки: звено (hook) лежит внутри самого объекта, который
+// наследуется от SListHook/ListHook. Список ничего не выделяет и не копирует,
+// он только связывает чужие объекты, поэтому вставка не аллоцирует, а
+// двусвязный список удаляет элемент по ссылке за O(1). Временем жизни
+// объектов управляет вызывающий код: объект нужно убрать из списка раньше,
+// чем он будет уничтожен. Тег позволяет одному объекту состоять в нескольких
+// списках сразу (по одному звену на тег).
+
+struct DefaultHookTag {};
+
+template<typename Tag = DefaultHookTag>
+class SListHook {
+private:
+    SListHook* next;   // Несвязанное звено указывает само на себя
+    
+    template<typename T, typename ListTag> friend class IntrusiveSinglyList;
+
+public:
+    SListHook() : next(this) {}
+    // Копия объекта в список не попадает
+    SListHook(const SListHook&) : next(this) {}
+    SListHook& operator=(const SListHook&) { return *this; }
+    
+    bool isLinked() const {
+        return next != this;
+    }
+};
+
+template<typename Tag = DefaultHookTag>
+class ListHook {
+private:
+    ListHook* prev;
+    ListHook* next;
+    
+    template<typename T, typename ListTag> friend class IntrusiveDoublyList;
+
+public:
+    ListHook() : prev(nullptr), next(nullptr) {}
+    ListHook(const ListHook&) : prev(nullptr), next(nullptr) {}
+    ListHook& operator=(const ListHook&) { return *this; }
+    
+    bool isLinked() const {
+        return next != nullptr;
+    }
+};
+
+template<typename T, typename Tag = DefaultHookTag>
+class IntrusiveSinglyList {
+private:
+    using Hook = SListHook<Tag>;
+    static_assert(std::is_base_of<Hook, T>::value, "T must derive from SListHook<Tag>");
+    
+    Hook* head;
+    Hook* tail;
+    size_t listSize;
+    
+    static Hook* hookOf(T& item) {
+        return static_cast<Hook*>(&item);
+    }
+    
+    static T& ownerOf(Hook* hook) {
+        return *static_cast<T*>(hook);
+    }
+    
+    static void requireUnlinked(T& item) {
+        if (hookOf(item)->isLinked()) {
+            throw std::invalid_argument("Element is already linked");
+        }
+    }
+
+public:
+    template<bool IsConst>
+    class Iterator {
+    private:
+        Hook* hook;
+        
+        explicit Iterator(Hook* current) : hook(current) {}
+        
+        friend class IntrusiveSinglyList;
+        friend class Iterator<!IsConst>;
+    
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference = typename std::conditional<IsConst, const T&, T&>::type;
+        
+        Iterator() : hook(nullptr) {}
+        
+        operator Iterator<true>() const {
+            return Iterator<true>(hook);
+        }
+        
+        reference operator*() const {
+            return ownerOf(hook);
+        }
+        
+        pointer operator->() const {
+            return &ownerOf(hook);
+        }
+        
+        Iterator& operator++() {
+            hook = hook->next;
+            return *this;
+        }
+        
+        Iterator operator++(int) {
+            Iterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+        
+        bool operator==(const Iterator& other) const {
+            return hook == other.hook;
+        }
+        
+        bool operator!=(const Iterator& other) const {
+            return hook != other.hook;
+        }
+    };
+    
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    
+    IntrusiveSinglyList() : head(nullptr), tail(nullptr), listSize(0) {}
+    
+    IntrusiveSinglyList(const IntrusiveSinglyList&) = delete;
+    IntrusiveSinglyList& operator=(const IntrusiveSinglyList&) = delete;
+    
+    ~IntrusiveSinglyList() {
+        clear();
+    }
+    
+    void push_front(T& item) {
+        requireUnlinked(item);
+        Hook* hook = hookOf(item);
+        hook->next = head;
+        head = hook;
+        if (tail == nullptr) {
+            tail = hook;
+        }
+        listSize++;
+    }
+    
+    void push_back(T& item) {
+        requireUnlinked(item);
+        Hook* hook = hookOf(item);
+        hook->next = nullptr;
+        if (tail == nullptr) {
+            head = hook;
+        } else {
+            tail->next = hook;
+        }
+        tail = hook;
+        listSize++;
+    }
+    
+    // Вставка сразу за position, который уже лежит в этом списке
+    void insertAfter(T& position, T& item) {
+        requireUnlinked(item);
+        Hook* before = hookOf(position);
+        Hook* hook = hookOf(item);
+        hook->next = before->next;
+        before->next = hook;
+        if (tail == before) {
+            tail = hook;
+        }
+        listSize++;
+    }
+    
+    T& pop_front() {
+        if (head == nullptr) {
+            throw std::runtime_error("List is empty");
+        }
+        Hook* hook = head;
+        head = hook->next;
+        if (head == nullptr) {
+            tail = nullptr;
+        }
+        hook->next = hook;
+        listSize--;
+        return ownerOf(hook);
+    }
+    
+    // Снимает элемент за position; исключение, если position последний
+    T& eraseAfter(T& position) {
+        Hook* before = hookOf(position);
+        Hook* hook = before->next;
+        if (hook == nullptr) {
+            throw std::out_of_range("Index out of range");
+        }
+        before->next = hook->next;
+        if (tail == hook) {
+            tail = before;
+        }
+        hook->next = hook;
+        listSize--;
+        return ownerOf(hook);
+    }
+    
+    // Поиск предшественника - O(n); false, если элемента в списке нет
+    bool remove(T& item) {
+        Hook* hook = hookOf(item);
+        if (!hook->isLinked() || head == nullptr) {
+            return false;
+        }
+        if (head == hook) {
+            pop_front();
+            return true;
+        }
+        for (Hook* current = head; current->next != nullptr; current = current->next) {
+            if (current->next == hook) {
+                eraseAfter(ownerOf(current));
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    T& front() {
+        if (head == nullptr) {
+            throw std::runtime_error("List is empty");
+        }
+        return ownerOf(head);
+    }
+    
+    T& back() {
+        if (tail == nullptr) {
+            throw std::runtime_error("List is empty");
+        }
+        return ownerOf(tail);
+    }
+    
+    size_t size() const {
+        return listSize;
+    }
+    
+    bool empty() const {
+        return listSize == 0;
+    }
+    
+    // Отвязывает все элементы, сами объекты не трогает
+    void clear() {
+        while (head != nullptr) {
+            Hook* hook = head;
+            head = hook->next;
+            hook->next = hook;
+        }
+        tail = nullptr;
+        listSize = 0;
+    }
+    
+    iterator begin() { return iterator(head); }
+    iterator end() { return iterator(nullptr); }
+    const_iterator begin() const { return const_iterator(head); }
+    const_iterator end() const { return const_iterator(nullptr); }
+};
+
+template<typename T, typename Tag = DefaultHookTag>
+class IntrusiveDoublyList {
+private:
+    using Hook = ListHook<Tag>;
+    static_assert(std::is_base_of<Hook, T>::value, "T must derive from ListHook<Tag>");
+    
+    // Кольцо с заглавным звеном: у каждого элемента есть оба соседа,
+    // поэтому вставка и удаление обходятся без проверок на края
+    Hook header;
+    size_t listSize;
+    
+    static Hook* hookOf(T& item) {
+        return static_cast<Hook*>(&item);
+    }
+    
+    static T& ownerOf(Hook* hook) {
+        return *static_cast<T*>(hook);
+    }
+    
+    void linkBefore(Hook* position, T& item) {
+        Hook* hook = hookOf(item);
+        if (hook->isLinked()) {
+            throw std::invalid_argument("Element is already linked");
+        }
+        hook->prev = position->prev;
+        hook->next = position;
+        position->prev->next = hook;
+        position->prev = hook;
+        listSize++;
+    }
+    
+    T& unlink(Hook* hook) {
+        hook->prev->next = hook->next;
+        hook->next->prev = hook->prev;
+        hook->prev = nullptr;
+        hook->next = nullptr;
+        listSize--;
+        return ownerOf(hook);
+    }
+
+public:
+    template<bool IsConst>
+    class Iterator {
+    private:
+        Hook* hook;
+        
+        explicit Iterator(Hook* current) : hook(current) {}
+        
+        friend class IntrusiveDoublyList;
+        friend class Iterator<!IsConst>;
+    
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference = typename std::conditional<IsConst, const T&, T&>::type;
+        
+        Iterator() : hook(nullptr) {}
+        
+        operator Iterator<true>() const {
+            return Iterator<true>(hook);
+        }
+        
+        reference operator*() const {
+            return ownerOf(hook);
+        }
+        
+        pointer operator->() const {
+            return &ownerOf(hook);
+        }
+        
+        Iterator& operator++() {
+            hook = hook->next;
+            return *this;
+        }
+        
+        Iterator operator++(int) {
+            Iterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+        
+        Iterator& operator--() {
+            hook = hook->prev;
+            return *this;
+        }
+        
+        Iterator operator--(int) {
+            Iterator previous = *this;
+            --(*this);
+            return previous;
+        }
+        
+        bool operator==(const Iterator& other) const {
+            return hook == other.hook;
+        }
+        
+        bool operator!=(const Iterator& other) const {
+            return hook != other.hook;
+        }
+    };
+    
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    
+    IntrusiveDoublyList() : header(), listSize(0) {
+        header.prev = &header;
+        header.next = &header;
+    }
+    
+    // Соседи ссылаются на заглавное звено, поэтому список не копируется и не перемещается
+    IntrusiveDoublyList(const IntrusiveDoublyList&) = delete;
+    IntrusiveDoublyList& operator=(const IntrusiveDoublyList&) = delete;
+    
+    ~IntrusiveDoublyList() {
+        clear();
+    }
+    
+    void push_front(T& item) {
+        linkBefore(header.next, item);
+    }
+    
+    void push_back(T& item) {
+        linkBefore(&header, item);
+    }
+    
+    // Вставка перед position; возвращает итератор на item
+    iterator insert(const_iterator position, T& item) {
+        linkBefore(position.hook, item);
+        return iterator(hookOf(item));
+    }
+    
+    T& pop_front() {
+        if (listSize == 0) {
+            throw std::runtime_error("List is empty");
+        }
+        return unlink(header.next);
+    }
+    
+    T& pop_back() {
+        if (listSize == 0) {
+            throw std::runtime_error("List is empty");
+        }
+        return unlink(header.prev);
+    }
+    
+    // Удаление по ссылке за O(1); элемент должен лежать в этом списке
+    void erase(T& item) {
+        Hook* hook = hookOf(item);
+        if (!hook->isLinked()) {
+            throw std::invalid_argument("Element is not linked");
+        }
+        unlink(hook);
+    }
+    
+    iterator erase(const_iterator position) {
+        Hook* next = position.hook->next;
+        unlink(position.hook);
+        return iterator(next);
+    }
+    
+    // Итератор на элемент, уже лежащий в этом списке, без поиска
+    iterator iteratorTo(T& item) {
+        return iterator(hookOf(item));
+    }
+    
+    // Переносит все элементы other в конец этого списка за O(1)
+    void splice(IntrusiveDoublyList& other) {
+        if (&other == this) {
+            throw std::invalid_argument("Cannot splice a list into itself");
+        }
+        if (other.listSize == 0) {
+            return;
+        }
+        Hook* first = other.header.next;
+        Hook* last = other.header.prev;
+        first->prev = header.prev;
+        header.prev->next = first;
+        last->next = &header;
+        header.prev = last;
+        listSize += other.listSize;
+        
+        other.header.prev = &other.header;
+        other.header.next = &other.header;
+        other.listSize = 0;
+    }
+    
+    T& front() {
+        if (listSize == 0) {
+            throw std::runtime_error("List is empty");
+        }
+        return ownerOf(header.next);
+    }
+    
+    T& back() {
+        if (listSize == 0) {
+            throw std::runtime_error("List is empty");
+        }
+        return ownerOf(header.prev);
+    }
+    
+    size_t size() const {
+        return listSize;
+    }
+    
+    bool empty() const {
+        return listSize == 0;
+    }
+    
+    void clear() {
+        Hook* current = header.next;
+        while (current != &header) {
+            Hook* next = current->next;
+            current->prev = nullptr;
+            current->next = nullptr;
+            current = next;
+        }
+        header.prev = &header;
+        header.next = &header;
+        listSize = 0;
+    }
+    
+    iterator begin() { return iterator(header.next); }
+    iterator end() { return iterator(&header); }
+    const_iterator begin() const { return const_iterator(header.next); }
+    const_iterator end() const { return const_iterator(const_cast<Hook*>(&header)); }
+};
+
+#endif
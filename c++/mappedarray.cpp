@@ -0,0 +1,183 @@
+#include "mappedarray.h"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedArray::MappedArray()
+    : mapping(nullptr), mappingSize(0), count(0), offsets(nullptr), blob(nullptr), blobSize(0),
+      scannedIndex() {}
+
+MappedArray::MappedArray(const std::string& filename) : MappedArray() {
+    open(filename);
+}
+
+MappedArray::MappedArray(MappedArray&& other) noexcept
+    : mapping(other.mapping), mappingSize(other.mappingSize), count(other.count),
+      offsets(other.offsets), blob(other.blob), blobSize(other.blobSize),
+      scannedIndex(std::move(other.scannedIndex)) {
+    other.mapping = nullptr;
+    other.mappingSize = 0;
+    other.count = 0;
+    other.offsets = nullptr;
+    other.blob = nullptr;
+    other.blobSize = 0;
+}
+
+MappedArray& MappedArray::operator=(MappedArray&& other) noexcept {
+    if (this != &other) {
+        close();
+        mapping = other.mapping;
+        mappingSize = other.mappingSize;
+        count = other.count;
+        offsets = other.offsets;
+        blob = other.blob;
+        blobSize = other.blobSize;
+        scannedIndex = std::move(other.scannedIndex);
+        other.mapping = nullptr;
+        other.mappingSize = 0;
+        other.count = 0;
+        other.offsets = nullptr;
+        other.blob = nullptr;
+        other.blobSize = 0;
+    }
+    return *this;
+}
+
+MappedArray::~MappedArray() {
+    close();
+}
+
+void MappedArray::open(const std::string& filename) {
+    close();
+    
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open file: " + filename);
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(uint64_t))) {
+        ::close(fd);
+        throw std::runtime_error("Invalid mapped array file: " + filename);
+    }
+    
+    size_t fileSize = static_cast<size_t>(info.st_size);
+    void* memory = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // Отображение остается действительным и после закрытия дескриптора
+    if (memory == MAP_FAILED) {
+        throw std::runtime_error("Cannot map file: " + filename);
+    }
+    mapping = static_cast<const char*>(memory);
+    mappingSize = fileSize;
+    
+    try {
+        uint64_t magic = 0;
+        if (mappingSize >= sizeof(Header)) {
+            std::memcpy(&magic, mapping, sizeof(magic));
+        }
+        if (magic == MAGIC) {
+            indexMappedLayout();
+        } else {
+            indexArrayLayout();
+        }
+    } catch (...) {
+        close();
+        throw;
+    }
+}
+
+void MappedArray::indexMappedLayout() {
+    Header header;
+    std::memcpy(&header, mapping, sizeof(header));
+    
+    // Таблица смещений должна целиком помещаться в файл
+    size_t available = (mappingSize - sizeof(Header)) / sizeof(uint64_t);
+    if (header.count >= available) {
+        throw std::runtime_error("Invalid mapped array file");
+    }
+    offsets = reinterpret_cast<const uint64_t*>(mapping + sizeof(Header));
+    blob = reinterpret_cast<const char*>(offsets + header.count + 1);
+    
+    blobSize = mappingSize - static_cast<size_t>(blob - mapping);
+    if (offsets[0] != 0 || offsets[header.count] > blobSize) {
+        throw std::runtime_error("Invalid mapped array file");
+    }
+    count = static_cast<size_t>(header.count);
+}
+
+void MappedArray::indexArrayLayout() {
+    uint64_t arrSize;
+    std::memcpy(&arrSize, mapping, sizeof(arrSize));
+    
+    size_t pos = sizeof(arrSize);
+    scannedIndex.reserve(static_cast<size_t>(std::min<uint64_t>(arrSize, mappingSize / sizeof(uint64_t))));
+    for (uint64_t i = 0; i < arrSize; ++i) {
+        if (mappingSize - pos < sizeof(uint64_t)) {
+            throw std::runtime_error("Invalid mapped array file");
+        }
+        uint64_t strLen;
+        std::memcpy(&strLen, mapping + pos, sizeof(strLen));
+        if (mappingSize - pos - sizeof(strLen) < strLen) {
+            throw std::runtime_error("Invalid mapped array file");
+        }
+        scannedIndex.push_back(pos);
+        pos += sizeof(strLen) + static_cast<size_t>(strLen);
+    }
+    count = static_cast<size_t>(arrSize);
+}
+
+void MappedArray::close() {
+    if (mapping != nullptr) {
+        munmap(const_cast<char*>(mapping), mappingSize);
+    }
+    mapping = nullptr;
+    mappingSize = 0;
+    count = 0;
+    offsets = nullptr;
+    blob = nullptr;
+    blobSize = 0;
+    scannedIndex.clear();
+    scannedIndex.shrink_to_fit();
+}
+
+bool MappedArray::isOpen() const {
+    return mapping != nullptr;
+}
+
+std::string_view MappedArray::get(size_t index) const {
+    if (index >= count) {
+        throw std::out_of_range("Index out of range");
+    }
+    if (offsets != nullptr) {
+        // Смещения проверяются при обращении, а не при открытии, чтобы не читать всю таблицу
+        uint64_t begin = offsets[index];
+        uint64_t end = offsets[index + 1];
+        if (begin > end || end > blobSize) {
+            throw std::runtime_error("Invalid mapped array file");
+        }
+        return std::string_view(blob + begin, static_cast<size_t>(end - begin));
+    }
+    uint64_t strLen;
+    std::memcpy(&strLen, mapping + scannedIndex[index], sizeof(strLen));
+    return std::string_view(mapping + scannedIndex[index] + sizeof(strLen), strLen);
+}
+
+size_t MappedArray::size() const {
+    return count;
+}
+
+bool MappedArray::empty() const {
+    return count == 0;
+}
+
+void MappedArray::print() const {
+    std::cout << "[";
+    for (size_t i = 0; i < count; ++i) {
+        std::cout << "\"" << get(i) << "\"";
+        if (i < count - 1) std::cout << ", ";
+    }
+    std::cout << "]" << std::endl;
+}
@@ -0,0 +1,64 @@
+#ifndef MAPPEDARRAY_H
+#define MAPPEDARRAY_H
+
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Массив строк только для чтения поверх файла, отображенного в память (mmap).
+// Строки не копируются: get(i) возвращает string_view прямо в отображение,
+// страницы подгружаются системой лениво, при первом обращении.
+//
+// Основной формат (пишет SerializationUtils::saveToMappedFile):
+//   Header { MAGIC, count }, uint64_t offsets[count + 1], байты всех строк подряд.
+// Строка i - это байты [offsets[i], offsets[i + 1]) после таблицы смещений,
+// поэтому открытие файла не читает сами данные.
+// Обычный бинарный файл Array тоже открывается, но для него индекс строится
+// проходом по длинам элементов.
+class MappedArray {
+public:
+    static const uint64_t MAGIC = 0x3130524141504D4DULL;  // "MMPAAR01"
+    
+    struct Header {
+        uint64_t magic;
+        uint64_t count;
+    };
+
+private:
+    const char* mapping;
+    size_t mappingSize;
+    size_t count;
+    
+    const uint64_t* offsets;            // Таблица смещений в отображении
+    const char* blob;                   // Начало байтов строк
+    size_t blobSize;
+    std::vector<uint64_t> scannedIndex; // Позиции длин для файла формата Array
+    
+    void indexMappedLayout();
+    void indexArrayLayout();
+
+public:
+    MappedArray();
+    explicit MappedArray(const std::string& filename);
+    MappedArray(const MappedArray&) = delete;
+    MappedArray& operator=(const MappedArray&) = delete;
+    MappedArray(MappedArray&& other) noexcept;
+    MappedArray& operator=(MappedArray&& other) noexcept;
+    ~MappedArray();
+    
+    void open(const std::string& filename);
+    void close();
+    bool isOpen() const;
+    
+    // Представление действительно, пока файл открыт
+    std::string_view get(size_t index) const;
+    size_t size() const;
+    bool empty() const;
+    
+    void print() const;
+};
+
+#endif
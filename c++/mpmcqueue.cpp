@@ -0,0 +1,140 @@
+#include "mpmcqueue.h"
+#include <cstdint>
+
+MPMCQueue::MPMCQueue(size_t capacity) : cells(nullptr), mask(0), enqueuePos(0), dequeuePos(0) {
+    size_t rounded = MIN_CAPACITY;
+    while (rounded < capacity) {
+        rounded *= 2;
+    }
+    cells = new Cell[rounded];
+    mask = rounded - 1;
+    for (size_t i = 0; i < rounded; ++i) {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+MPMCQueue::~MPMCQueue() {
+    delete[] cells;
+}
+
+MPMCQueue::Cell* MPMCQueue::claimForEnqueue(size_t& pos) {
+    pos = enqueuePos.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell* cell = &cells[pos & mask];
+        size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            // Ячейка свободна на этом круге - пытаемся забрать позицию
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                return cell;
+            }
+        } else if (diff < 0) {
+            // Потребитель еще не освободил ячейку с прошлого круга
+            return nullptr;
+        } else {
+            pos = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+MPMCQueue::Cell* MPMCQueue::claimForDequeue(size_t& pos) {
+    pos = dequeuePos.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell* cell = &cells[pos & mask];
+        size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+        if (diff == 0) {
+            if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                return cell;
+            }
+        } else if (diff < 0) {
+            return nullptr;
+        } else {
+            pos = dequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool MPMCQueue::try_enqueue(const std::string& value) {
+    size_t pos;
+    Cell* cell = claimForEnqueue(pos);
+    if (cell == nullptr) {
+        return false;
+    }
+    cell->data = value;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool MPMCQueue::try_enqueue(std::string&& value) {
+    size_t pos;
+    Cell* cell = claimForEnqueue(pos);
+    if (cell == nullptr) {
+        return false;
+    }
+    cell->data = std::move(value);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool MPMCQueue::try_dequeue(std::string& out) {
+    size_t pos;
+    Cell* cell = claimForDequeue(pos);
+    if (cell == nullptr) {
+        return false;
+    }
+    out = std::move(cell->data);
+    cell->data.clear();
+    cell->sequence.store(pos + mask + 1, std::memory_order_release);
+    return true;
+}
+
+size_t MPMCQueue::size() const {
+    size_t tail = enqueuePos.load(std::memory_order_acquire);
+    size_t head = dequeuePos.load(std::memory_order_acquire);
+    return (tail > head) ? tail - head : 0;
+}
+
+bool MPMCQueue::empty() const {
+    return size() == 0;
+}
+
+size_t MPMCQueue::capacity() const {
+    return mask + 1;
+}
+
+void MPMCQueue::serialize(std::ostream& os) const {
+    size_t head = dequeuePos.load(std::memory_order_acquire);
+    size_t count = size();
+    os.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    for (size_t i = 0; i < count; ++i) {
+        const std::string& value = cells[(head + i) & mask].data;
+        size_t strLen = value.length();
+        os.write(reinterpret_cast<const char*>(&strLen), sizeof(strLen));
+        os.write(value.c_str(), strLen);
+    }
+}
+
+void MPMCQueue::deserialize(std::istream& is) {
+    size_t queueSize;
+    is.read(reinterpret_cast<char*>(&queueSize), sizeof(queueSize));
+    if (queueSize > capacity()) {
+        throw std::runtime_error("Queue capacity exceeded");
+    }
+    
+    // Начинаем с нуля: все ячейки снова свободны на первом круге
+    for (size_t i = 0; i <= mask; ++i) {
+        cells[i].data.clear();
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    enqueuePos.store(0, std::memory_order_relaxed);
+    dequeuePos.store(0, std::memory_order_relaxed);
+    
+    for (size_t i = 0; i < queueSize; ++i) {
+        size_t strLen;
+        is.read(reinterpret_cast<char*>(&strLen), sizeof(strLen));
+        std::string value(strLen, ' ');
+        is.read(&value[0], strLen);
+        try_enqueue(std::move(value));
+    }
+}
@@ -0,0 +1,98 @@
+#ifndef MPMCQUEUE_H
+#define MPMCQUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// Ограниченная lock-free очередь для нескольких производителей и
+// потребителей (схема Д. Вьюкова). Каждая ячейка кольцевого буфера хранит
+// номер очереди (sequence): производитель захватывает позицию CAS-ом по
+// enqueuePos и публикует значение, записывая sequence = pos + 1; потребитель
+// ждет именно этот номер и освобождает ячейку для следующего круга.
+// Счетчики позиций и ячейки выровнены по кэш-линии, чтобы потоки не делили
+// одну линию. Емкость фиксирована и округляется вверх до степени двойки.
+// Формат бинарного снимка совпадает с Queue::serialize.
+class MPMCQueue {
+private:
+    static const size_t CACHE_LINE = 64;
+    static const size_t MIN_CAPACITY = 2;
+    
+    struct alignas(CACHE_LINE) Cell {
+        std::atomic<size_t> sequence;
+        std::string data;
+    };
+    
+    Cell* cells;
+    size_t mask;
+    
+    alignas(CACHE_LINE) std::atomic<size_t> enqueuePos;
+    alignas(CACHE_LINE) std::atomic<size_t> dequeuePos;
+    
+    // Захватывает свободную ячейку; nullptr, если очередь полна
+    Cell* claimForEnqueue(size_t& pos);
+    // Захватывает заполненную ячейку; nullptr, если очередь пуста
+    Cell* claimForDequeue(size_t& pos);
+
+public:
+    explicit MPMCQueue(size_t capacity);
+    ~MPMCQueue();
+    
+    MPMCQueue(const MPMCQueue&) = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+    
+    // false, если очередь полна; значение при этом не перемещается
+    bool try_enqueue(const std::string& value);
+    bool try_enqueue(std::string&& value);
+    // false, если очередь пуста
+    bool try_dequeue(std::string& out);
+    
+    // Пакетные варианты: каждый элемент - отдельная lock-free операция,
+    // обработка останавливается на первой неудаче. Возвращают число элементов.
+    template<typename InputIt>
+    size_t try_enqueue_batch(InputIt first, InputIt last) {
+        size_t added = 0;
+        for (; first != last; ++first) {
+            size_t pos;
+            Cell* cell = claimForEnqueue(pos);
+            if (cell == nullptr) {
+                break;
+            }
+            cell->data = std::move(*first);
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            added++;
+        }
+        return added;
+    }
+    
+    template<typename OutputIt>
+    size_t try_dequeue_batch(OutputIt out, size_t maxCount) {
+        size_t taken = 0;
+        while (taken < maxCount) {
+            size_t pos;
+            Cell* cell = claimForDequeue(pos);
+            if (cell == nullptr) {
+                break;
+            }
+            *out++ = std::move(cell->data);
+            cell->data.clear();
+            cell->sequence.store(pos + mask + 1, std::memory_order_release);
+            taken++;
+        }
+        return taken;
+    }
+    
+    // При одновременной работе потоков значения приблизительные
+    size_t size() const;
+    bool empty() const;
+    size_t capacity() const;
+    
+    // Снимок и загрузка допустимы только без параллельных операций
+    void serialize(std::ostream& os) const;
+    void deserialize(std::istream& is);
+};
+
+#endif
@@ -0,0 +1,150 @@
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+// Пул узлов для связных списков. Память берется крупными блоками (slab),
+// освобожденные узлы попадают в список свободных и переиспользуются при
+// следующем create(), поэтому при чередовании вставок и удалений глобальный
+// аллокатор почти не вызывается, а узлы лежат в памяти плотно.
+// Все блоки возвращаются системе разом в releaseAll().
+template<typename NodeT>
+class NodePool {
+private:
+    static const size_t FIRST_SLAB_NODES = 16;
+    static const size_t MAX_SLAB_NODES = 1024;
+    
+    union Slot {
+        Slot* next;   // Следующий свободный слот или, в слоте 0, предыдущий блок
+        alignas(NodeT) unsigned char storage[sizeof(NodeT)];
+    };
+    
+    Slot* slabs;        // Нулевые слоты блоков связаны в список
+    Slot* oldestSlab;   // Конец этого списка, нужен для absorb()
+    Slot* freeList;
+    Slot* freeTail;
+    Slot* bumpCursor;   // Еще не выдававшиеся слоты текущего блока
+    size_t bumpLeft;
+    size_t nextSlabNodes;
+    size_t slabTotal;
+    
+    Slot* acquire() {
+        if (freeList != nullptr) {
+            Slot* slot = freeList;
+            freeList = slot->next;
+            if (freeList == nullptr) {
+                freeTail = nullptr;
+            }
+            return slot;
+        }
+        if (bumpLeft == 0) {
+            Slot* slab = new Slot[nextSlabNodes + 1];
+            slab[0].next = slabs;
+            if (slabs == nullptr) {
+                oldestSlab = slab;
+            }
+            slabs = slab;
+            bumpCursor = slab + 1;
+            bumpLeft = nextSlabNodes;
+            slabTotal++;
+            if (nextSlabNodes < MAX_SLAB_NODES) {
+                nextSlabNodes *= 2;
+            }
+        }
+        bumpLeft--;
+        return bumpCursor++;
+    }
+    
+    void release(Slot* slot) {
+        if (freeList == nullptr) {
+            freeTail = slot;
+        }
+        slot->next = freeList;
+        freeList = slot;
+    }
+
+public:
+    NodePool()
+        : slabs(nullptr), oldestSlab(nullptr), freeList(nullptr), freeTail(nullptr),
+          bumpCursor(nullptr), bumpLeft(0),
+          nextSlabNodes(FIRST_SLAB_NODES), slabTotal(0) {}
+    
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+    
+    ~NodePool() {
+        releaseAll();
+    }
+    
+    template<typename... Args>
+    NodeT* create(Args&&... args) {
+        Slot* slot = acquire();
+        try {
+            return new (slot->storage) NodeT(std::forward<Args>(args)...);
+        } catch (...) {
+            release(slot);
+            throw;
+        }
+    }
+    
+    void destroy(NodeT* node) {
+        node->~NodeT();
+        release(reinterpret_cast<Slot*>(node));
+    }
+    
+    // Освобождает все блоки; живых узлов к этому моменту быть не должно
+    void releaseAll() {
+        while (slabs != nullptr) {
+            Slot* previous = slabs[0].next;
+            delete[] slabs;
+            slabs = previous;
+        }
+        oldestSlab = nullptr;
+        freeList = nullptr;
+        freeTail = nullptr;
+        bumpCursor = nullptr;
+        bumpLeft = 0;
+        nextSlabNodes = FIRST_SLAB_NODES;
+        slabTotal = 0;
+    }
+    
+    // Забирает все блоки other за O(1): живые узлы other становятся узлами
+    // этого пула, other остается пустым. Невыданный остаток текущего блока
+    // other используется, только если у этого пула своего остатка нет.
+    void absorb(NodePool& other) {
+        if (&other == this || other.slabs == nullptr) {
+            return;
+        }
+        other.oldestSlab[0].next = slabs;
+        if (slabs == nullptr) {
+            oldestSlab = other.oldestSlab;
+        }
+        slabs = other.slabs;
+        if (other.freeList != nullptr) {
+            other.freeTail->next = freeList;
+            if (freeList == nullptr) {
+                freeTail = other.freeTail;
+            }
+            freeList = other.freeList;
+        }
+        if (bumpLeft == 0) {
+            bumpCursor = other.bumpCursor;
+            bumpLeft = other.bumpLeft;
+        }
+        slabTotal += other.slabTotal;
+        if (other.nextSlabNodes > nextSlabNodes) {
+            nextSlabNodes = other.nextSlabNodes;
+        }
+        
+        other.slabs = nullptr;
+        other.releaseAll();
+    }
+    
+    size_t slabCount() const {
+        return slabTotal;
+    }
+};
+
+#endif
@@ -1,45 +1,135 @@
 #include "queue.h"
 #include <stdexcept>
 
-Queue::Queue() : list() {}
+Queue::Queue() : items(nullptr), capacity(0), head(0), count(0) {}
+
+Queue::Queue(const Queue& other) : Queue() {
+    *this = other;
+}
+
+Queue::Queue(Queue&& other) noexcept
+    : items(other.items), capacity(other.capacity), head(other.head), count(other.count) {
+    other.items = nullptr;
+    other.capacity = 0;
+    other.head = 0;
+    other.count = 0;
+}
+
+Queue& Queue::operator=(const Queue& other) {
+    if (this != &other) {
+        clear();
+        grow(other.count);
+        for (size_t i = 0; i < other.count; ++i) {
+            slot(i) = other.slot(i);
+        }
+        count = other.count;
+    }
+    return *this;
+}
+
+Queue& Queue::operator=(Queue&& other) noexcept {
+    if (this != &other) {
+        delete[] items;
+        items = other.items;
+        capacity = other.capacity;
+        head = other.head;
+        count = other.count;
+        other.items = nullptr;
+        other.capacity = 0;
+        other.head = 0;
+        other.count = 0;
+    }
+    return *this;
+}
+
+Queue::~Queue() {
+    delete[] items;
+}
+
+size_t Queue::mask() const {
+    return capacity - 1;
+}
+
+std::string& Queue::slot(size_t offset) const {
+    return items[(head + offset) & mask()];
+}
+
+void Queue::grow(size_t required) {
+    if (required <= capacity) {
+        return;
+    }
+    if (required > MAX_CAPACITY) {
+        throw std::length_error("Queue size limit exceeded");
+    }
+    size_t newCapacity = (capacity == 0) ? MIN_CAPACITY : capacity;
+    while (newCapacity < required) {
+        newCapacity *= 2;
+    }
+    
+    // Переносим элементы подряд, голова становится нулевым слотом
+    std::string* newItems = new std::string[newCapacity];
+    for (size_t i = 0; i < count; ++i) {
+        newItems[i] = std::move(slot(i));
+    }
+    delete[] items;
+    items = newItems;
+    capacity = newCapacity;
+    head = 0;
+}
 
 void Queue::enqueue(const std::string& value) {
-    list.push_back(value);
+    grow(count + 1);
+    slot(count++) = value;
+}
+
+void Queue::enqueue(std::string&& value) {
+    grow(count + 1);
+    slot(count++) = std::move(value);
 }
 
 std::string Queue::dequeue() {
     if (empty()) {
         throw std::runtime_error("Queue is empty");
     }
-    std::string value = list.get(0);
-    list.pop_front();
+    std::string value = std::move(slot(0));
+    head = (head + 1) & mask();
+    count--;
     return value;
 }
 
-std::string Queue::front() const {
+const std::string& Queue::front() const {
     if (empty()) {
         throw std::runtime_error("Queue is empty");
     }
-    return list.get(0);
+    return slot(0);
 }
 
-std::string Queue::back() const {
+const std::string& Queue::back() const {
     if (empty()) {
         throw std::runtime_error("Queue is empty");
     }
-    return list.get(list.size() - 1);
+    return slot(count - 1);
 }
 
 bool Queue::empty() const {
-    return list.empty();
+    return count == 0;
 }
 
 size_t Queue::size() const {
-    return list.size();
+    return count;
+}
+
+void Queue::reserve(size_t newCapacity) {
+    grow(newCapacity);
+}
+
+size_t Queue::getCapacity() const {
+    return capacity;
 }
 
 void Queue::clear() {
-    list.clear();
+    head = 0;
+    count = 0;
 }
 
 void Queue::print() const {
@@ -49,25 +139,82 @@ void Queue::print() const {
     }
     
     std::cout << "Queue: [";
-    for (size_t i = 0; i < list.size(); ++i) {
-        std::cout << "\"" << list.get(i) << "\"";
-        if (i < list.size() - 1) std::cout << " <- ";
+    for (size_t i = 0; i < count; ++i) {
+        std::cout << "\"" << slot(i) << "\"";
+        if (i < count - 1) std::cout << " <- ";
     }
     std::cout << "]" << std::endl;
 }
 
 void Queue::serialize(std::ostream& os) const {
-    list.serialize(os);
+    os.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    for (size_t i = 0; i < count; ++i) {
+        const std::string& value = slot(i);
+        size_t strLen = value.length();
+        os.write(reinterpret_cast<const char*>(&strLen), sizeof(strLen));
+        os.write(value.c_str(), strLen);
+    }
 }
 
 void Queue::deserialize(std::istream& is) {
-    list.deserialize(is);
+    clear();
+    size_t queueSize;
+    is.read(reinterpret_cast<char*>(&queueSize), sizeof(queueSize));
+    
+    grow(queueSize);
+    for (size_t i = 0; i < queueSize; ++i) {
+        size_t strLen;
+        is.read(reinterpret_cast<char*>(&strLen), sizeof(strLen));
+        std::string& value = slot(count++);
+        value.resize(strLen);
+        is.read(&value[0], strLen);
+    }
 }
 
 void Queue::serializeText(std::ostream& os) const {
-    list.serializeText(os);
+    os << count << "\n";
+    for (size_t i = 0; i < count; ++i) {
+        std::string escaped = slot(i);
+        size_t pos = 0;
+        while ((pos = escaped.find('\n', pos)) != std::string::npos) {
+            escaped.replace(pos, 1, "\\n");
+            pos += 2;
+        }
+        pos = 0;
+        while ((pos = escaped.find('\"', pos)) != std::string::npos) {
+            escaped.replace(pos, 1, "\\\"");
+            pos += 2;
+        }
+        os << "\"" << escaped << "\"\n";
+    }
 }
 
 void Queue::deserializeText(std::istream& is) {
-    list.deserializeText(is);
+    clear();
+    size_t newSize;
+    is >> newSize;
+    is.get();
+    
+    grow(newSize);
+    for (size_t i = 0; i < newSize; ++i) {
+        std::string line;
+        std::getline(is, line);
+        
+        if (line.size() >= 2 && line.front() == '\"' && line.back() == '\"') {
+            line = line.substr(1, line.size() - 2);
+            
+            size_t pos = 0;
+            while ((pos = line.find("\\n", pos)) != std::string::npos) {
+                line.replace(pos, 2, "\n");
+                pos += 1;
+            }
+            pos = 0;
+            while ((pos = line.find("\\\"", pos)) != std::string::npos) {
+                line.replace(pos, 2, "\"");
+                pos += 1;
+            }
+        }
+        
+        enqueue(std::move(line));
+    }
 }
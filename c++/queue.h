@@ -1,25 +1,72 @@
 #ifndef QUEUE_H
 #define QUEUE_H
 
-#include "singlylinkedlist.h"
+#include <cstdint>
 #include <string>
 #include <iostream>
+#include <iterator>
 #include <stdexcept>
+#include <utility>
 
+// Очередь на кольцевом буфере, емкость - степень двойки. enqueue/dequeue
+// выполняются за O(1) без выделения памяти на каждый элемент, буфер растет
+// удвоением. Формат сериализации прежний: элементы от головы к хвосту.
 class Queue {
 private:
-    SinglyLinkedList list;
+    static const size_t MIN_CAPACITY = 8;
+    // Наибольшая емкость, при которой удвоение и размер буфера в байтах не переполняются
+    static const size_t MAX_CAPACITY = (SIZE_MAX / 2) / sizeof(std::string);
+    
+    std::string* items;
+    size_t capacity;      // 0 или степень двойки
+    size_t head;          // Индекс первого элемента
+    size_t count;
+    
+    size_t mask() const;
+    std::string& slot(size_t offset) const;
+    void grow(size_t required);
 
 public:
     Queue();
+    Queue(const Queue& other);
+    Queue(Queue&& other) noexcept;
+    Queue& operator=(const Queue& other);
+    Queue& operator=(Queue&& other) noexcept;
+    ~Queue();
     
     void enqueue(const std::string& value);
+    void enqueue(std::string&& value);
+    // Извлекает голову перемещением, без копирования строки
     std::string dequeue();
-    std::string front() const;
-    std::string back() const;
+    const std::string& front() const;
+    const std::string& back() const;
     bool empty() const;
     size_t size() const;
     
+    // Перемещает все элементы диапазона в хвост, память выделяется не больше одного раза
+    template<typename ForwardIt>
+    void enqueueBatch(ForwardIt first, ForwardIt last) {
+        grow(count + static_cast<size_t>(std::distance(first, last)));
+        for (; first != last; ++first) {
+            slot(count++) = std::move(*first);
+        }
+    }
+    
+    // Перемещает до maxCount элементов из головы в out, возвращает их число
+    template<typename OutputIt>
+    size_t dequeueBatch(OutputIt out, size_t maxCount) {
+        size_t taken = (maxCount < count) ? maxCount : count;
+        for (size_t i = 0; i < taken; ++i) {
+            *out++ = std::move(slot(i));
+        }
+        head = (head + taken) & mask();
+        count -= taken;
+        return taken;
+    }
+    
+    void reserve(size_t newCapacity);
+    size_t getCapacity() const;
+    
     void clear();
     void print() const;
     
@@ -1,8 +1,10 @@
 #ifndef SERIALIZATIONUTILS_H
 #define SERIALIZATIONUTILS_H
 
+#include <cstdint>
 #include <fstream>
 #include <string>
+#include "mappedarray.h"
 
 class SerializationUtils {
 public:
@@ -53,6 +55,32 @@ public:
         file.close();
         return true;
     }
+    
+    // Сохранение в формате MappedArray: заголовок, таблица смещений, байты строк.
+    // Подходит любой контейнер строк с size() и at(i)
+    template<typename T>
+    static bool saveToMappedFile(const T& obj, const std::string& filename) {
+        std::ofstream file(filename, std::ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+        
+        MappedArray::Header header = {MappedArray::MAGIC, static_cast<uint64_t>(obj.size())};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        
+        uint64_t offset = 0;
+        file.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+        for (size_t i = 0; i < obj.size(); ++i) {
+            offset += obj.at(i).size();
+            file.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+        }
+        for (size_t i = 0; i < obj.size(); ++i) {
+            file.write(obj.at(i).data(), obj.at(i).size());
+        }
+        
+        file.close();
+        return file.good();
+    }
 };
 
 #endif
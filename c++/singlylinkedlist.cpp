@@ -2,13 +2,17 @@
 #include <sstream>
 #include <algorithm>
 
-SinglyLinkedList::SinglyLinkedList() : head(nullptr), tail(nullptr), listSize(0) {}
+SinglyLinkedList::SinglyLinkedList()
+    : pool(), head(nullptr), tail(nullptr), listSize(0), cursor(nullptr), cursorIndex(0),
+      indexEnabled(false), positionsStale(false), positionShift(0), valueIndex() {}
 
 SinglyLinkedList::~SinglyLinkedList() {
     clear();
 }
 
-SinglyLinkedList::SinglyLinkedList(const SinglyLinkedList& other) : head(nullptr), tail(nullptr), listSize(0) {
+SinglyLinkedList::SinglyLinkedList(const SinglyLinkedList& other)
+    : pool(), head(nullptr), tail(nullptr), listSize(0), cursor(nullptr), cursorIndex(0),
+      indexEnabled(other.indexEnabled), positionsStale(false), positionShift(0), valueIndex() {
     Node* current = other.head;
     while (current != nullptr) {
         push_back(current->data);
@@ -19,6 +23,7 @@ SinglyLinkedList::SinglyLinkedList(const SinglyLinkedList& other) : head(nullptr
 SinglyLinkedList& SinglyLinkedList::operator=(const SinglyLinkedList& other) {
     if (this != &other) {
         clear();
+        indexEnabled = other.indexEnabled;
         Node* current = other.head;
         while (current != nullptr) {
             push_back(current->data);
@@ -29,7 +34,7 @@ SinglyLinkedList& SinglyLinkedList::operator=(const SinglyLinkedList& other) {
 }
 
 void SinglyLinkedList::push_front(const std::string& value) {
-    Node* newNode = new Node(value);
+    Node* newNode = pool.create(value);
     
     if (empty()) {
         head = tail = newNode;
@@ -38,10 +43,15 @@ void SinglyLinkedList::push_front(const std::string& value) {
         head = newNode;
     }
     listSize++;
+    if (cursor != nullptr) {
+        cursorIndex++;
+    }
+    positionShift++;
+    indexAdd(newNode, 0);
 }
 
 void SinglyLinkedList::push_back(const std::string& value) {
-    Node* newNode = new Node(value);
+    Node* newNode = pool.create(value);
     
     if (empty()) {
         head = tail = newNode;
@@ -50,6 +60,7 @@ void SinglyLinkedList::push_back(const std::string& value) {
         tail = newNode;
     }
     listSize++;
+    indexAdd(newNode, listSize - 1);
 }
 
 void SinglyLinkedList::pop_front() {
@@ -58,13 +69,20 @@ void SinglyLinkedList::pop_front() {
     }
     
     Node* temp = head;
+    indexRemove(temp);
+    positionShift--;
     head = head->next;
     
     if (head == nullptr) {
         tail = nullptr;
     }
     
-    delete temp;
+    if (cursor == temp) {
+        resetCursor();
+    } else if (cursor != nullptr) {
+        cursorIndex--;
+    }
+    pool.destroy(temp);
     listSize--;
 }
 
@@ -73,15 +91,16 @@ void SinglyLinkedList::pop_back() {
         throw std::runtime_error("List is empty");
     }
     
+    if (cursor == tail) {
+        resetCursor();
+    }
+    indexRemove(tail);
     if (head == tail) {
-        delete head;
+        pool.destroy(head);
         head = tail = nullptr;
     } else {
-        Node* current = head;
-        while (current->next != tail) {
-            current = current->next;
-        }
-        delete tail;
+        Node* current = nodeAt(listSize - 2);
+        pool.destroy(tail);
         tail = current;
         tail->next = nullptr;
     }
@@ -98,14 +117,16 @@ void SinglyLinkedList::insert(size_t index, const std::string& value) {
     } else if (index == listSize) {
         push_back(value);
     } else {
-        Node* current = head;
-        for (size_t i = 0; i < index - 1; ++i) {
-            current = current->next;
-        }
-        Node* newNode = new Node(value);
+        Node* current = nodeAt(index - 1);
+        Node* newNode = pool.create(value);
         newNode->next = current->next;
         current->next = newNode;
         listSize++;
+        positionsStale = true;
+        indexAdd(newNode, index);
+        // Индексы после вставки сдвинулись; курсор встает на новый узел
+        cursor = newNode;
+        cursorIndex = index;
     }
 }
 
@@ -117,10 +138,7 @@ void SinglyLinkedList::remove(size_t index) {
     if (index == 0) {
         pop_front();
     } else {
-        Node* current = head;
-        for (size_t i = 0; i < index - 1; ++i) {
-            current = current->next;
-        }
+        Node* current = nodeAt(index - 1);
         Node* nodeToDelete = current->next;
         current->next = nodeToDelete->next;
         
@@ -128,8 +146,12 @@ void SinglyLinkedList::remove(size_t index) {
             tail = current;
         }
         
-        delete nodeToDelete;
+        positionsStale = true;
+        indexRemove(nodeToDelete);
+        pool.destroy(nodeToDelete);
         listSize--;
+        cursor = current;
+        cursorIndex = index - 1;
     }
 }
 
@@ -138,11 +160,33 @@ std::string SinglyLinkedList::get(size_t index) const {
         throw std::out_of_range("Index out of range");
     }
     
+    return nodeAt(index)->data;
+}
+
+SinglyLinkedList::Node* SinglyLinkedList::nodeAt(size_t index) const {
+    // Вперед можно идти от курсора, назад - только от головы
     Node* current = head;
-    for (size_t i = 0; i < index; ++i) {
+    size_t position = 0;
+    if (cursor != nullptr && cursorIndex <= index) {
+        current = cursor;
+        position = cursorIndex;
+    }
+    if (index == listSize - 1) {
+        current = tail;
+        position = index;
+    }
+    while (position < index) {
         current = current->next;
+        position++;
     }
-    return current->data;
+    cursor = current;
+    cursorIndex = index;
+    return current;
+}
+
+void SinglyLinkedList::resetCursor() const {
+    cursor = nullptr;
+    cursorIndex = 0;
 }
 
 size_t SinglyLinkedList::size() const {
@@ -157,10 +201,15 @@ void SinglyLinkedList::clear() {
     while (head != nullptr) {
         Node* temp = head;
         head = head->next;
-        delete temp;
+        pool.destroy(temp);
     }
+    pool.releaseAll();
     tail = nullptr;
     listSize = 0;
+    resetCursor();
+    valueIndex.clear();
+    positionsStale = false;
+    positionShift = 0;
 }
 
 void SinglyLinkedList::print() const {
@@ -284,6 +333,10 @@ std::vector<std::string> SinglyLinkedList::toVector() const {
 }
 
 bool SinglyLinkedList::contains(const std::string& value) const {
+    if (indexEnabled) {
+        return valueIndex.count(value) != 0;
+    }
+    
     Node* current = head;
     while (current != nullptr) {
         if (current->data == value) {
@@ -293,3 +346,172 @@ bool SinglyLinkedList::contains(const std::string& value) const {
     }
     return false;
 }
+
+size_t SinglyLinkedList::indexOf(const std::string& value) const {
+    if (indexEnabled) {
+        auto found = valueIndex.find(value);
+        if (found == valueIndex.end()) {
+            return npos;
+        }
+        if (positionsStale) {
+            // Пересчет может собрать индекс заново, поэтому ищем еще раз
+            rebuildPositions();
+            found = valueIndex.find(value);
+            if (found == valueIndex.end()) {
+                return npos;
+            }
+        }
+        return static_cast<size_t>(found->second.firstPosition + positionShift);
+    }
+    
+    size_t position = 0;
+    for (const Node* current = head; current != nullptr; current = current->next) {
+        if (current->data == value) {
+            return position;
+        }
+        position++;
+    }
+    return npos;
+}
+
+size_t SinglyLinkedList::count(const std::string& value) const {
+    if (indexEnabled) {
+        auto found = valueIndex.find(value);
+        return (found == valueIndex.end()) ? 0 : found->second.count;
+    }
+    
+    size_t result = 0;
+    for (const Node* current = head; current != nullptr; current = current->next) {
+        if (current->data == value) {
+            result++;
+        }
+    }
+    return result;
+}
+
+void SinglyLinkedList::indexAdd(Node* node, size_t position) {
+    if (!indexEnabled) {
+        return;
+    }
+    
+    IndexEntry& entry = valueIndex[node->data];
+    long long raw = static_cast<long long>(position) - positionShift;
+    if (entry.count == 0) {
+        entry.first = node;
+        entry.firstPosition = raw;
+    } else if (!positionsStale && raw <= entry.firstPosition) {
+        entry.first = node;
+        entry.firstPosition = raw;
+    }
+    entry.count++;
+}
+
+void SinglyLinkedList::indexRemove(Node* node) {
+    if (!indexEnabled) {
+        return;
+    }
+    
+    auto found = valueIndex.find(node->data);
+    if (found == valueIndex.end()) {
+        // Значение переписали через iterator: индекс собираем заново без узла
+        rebuildIndex(node);
+        return;
+    }
+    IndexEntry& entry = found->second;
+    if (--entry.count == 0) {
+        valueIndex.erase(found);
+        return;
+    }
+    if (positionsStale || entry.first != node) {
+        return;
+    }
+    
+    // Удаляется первое вхождение: следующее не ищем, чтобы удаление с конца
+    // осталось O(1), а отдаем его пересчету в indexOf
+    entry.first = nullptr;
+    positionsStale = true;
+}
+
+void SinglyLinkedList::rebuildPositions() const {
+    for (auto& pair : valueIndex) {
+        pair.second.first = nullptr;
+    }
+    positionShift = 0;
+    long long position = 0;
+    for (Node* current = head; current != nullptr; current = current->next) {
+        auto found = valueIndex.find(current->data);
+        if (found == valueIndex.end()) {
+            rebuildIndex(nullptr);
+            rebuildPositions();
+            return;
+        }
+        IndexEntry& entry = found->second;
+        if (entry.first == nullptr) {
+            entry.first = current;
+            entry.firstPosition = position;
+        }
+        position++;
+    }
+    // Значение, которого в списке уже нет, тоже признак записи через iterator
+    for (const auto& pair : valueIndex) {
+        if (pair.second.first == nullptr) {
+            rebuildIndex(nullptr);
+            rebuildPositions();
+            return;
+        }
+    }
+    positionsStale = false;
+}
+
+void SinglyLinkedList::rebuildIndex(const Node* skip) const {
+    valueIndex.clear();
+    for (Node* current = head; current != nullptr; current = current->next) {
+        if (current != skip) {
+            valueIndex[current->data].count++;
+        }
+    }
+    positionsStale = true;
+    positionShift = 0;
+}
+
+void SinglyLinkedList::enableValueIndex() {
+    indexEnabled = true;
+    valueIndex.clear();
+    valueIndex.reserve(listSize);
+    positionsStale = false;
+    positionShift = 0;
+    size_t position = 0;
+    for (Node* current = head; current != nullptr; current = current->next) {
+        indexAdd(current, position);
+        position++;
+    }
+}
+
+void SinglyLinkedList::disableValueIndex() {
+    indexEnabled = false;
+    std::unordered_map<std::string, IndexEntry>().swap(valueIndex);
+    positionsStale = false;
+    positionShift = 0;
+}
+
+bool SinglyLinkedList::hasValueIndex() const {
+    return indexEnabled;
+}
+
+size_t SinglyLinkedList::valueIndexMemoryUsage() const {
+    if (!indexEnabled) {
+        return 0;
+    }
+    
+    // Узел unordered_map: пара ключ-значение, указатель next и кэш хеша
+    size_t perEntry = sizeof(std::pair<const std::string, IndexEntry>) + sizeof(void*) + sizeof(size_t);
+    size_t total = valueIndex.bucket_count() * sizeof(void*) + valueIndex.size() * perEntry;
+    // Длинные ключи не помещаются во встроенный буфер строки
+    size_t inlineCapacity = std::string().capacity();
+    for (const auto& pair : valueIndex) {
+        if (pair.first.capacity() > inlineCapacity) {
+            total += pair.first.capacity() + 1;
+        }
+    }
+    return total;
+}
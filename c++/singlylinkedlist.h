@@ -1,9 +1,14 @@
 #ifndef SINGLYLINKEDLIST_H
 #define SINGLYLINKEDLIST_H
 
+#include "nodepool.h"
+#include <cstddef>
 #include <iostream>
+#include <iterator>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 class SinglyLinkedList {
@@ -14,11 +19,100 @@ private:
         explicit Node(const std::string& val) : data(val), next(nullptr) {}
     };
     
+    NodePool<Node> pool;
     Node* head;
     Node* tail;
     size_t listSize;
+    
+    // Курсор последнего обращения по индексу: последовательные get(i), get(i + 1)
+    // проходят один узел. Из-за него одновременные чтения из разных потоков
+    // небезопасны даже через const-ссылку.
+    mutable Node* cursor;
+    mutable size_t cursorIndex;
+    
+    // Необязательный индекс значений: число вхождений и первое вхождение с его
+    // позицией. Позиция хранится со сдвигом positionShift, поэтому операции на
+    // концах списка обновляют ее за O(1); вставка и удаление в середине, а также
+    // удаление первого вхождения повторяющегося значения помечают позиции
+    // устаревшими, и indexOf пересчитывает их одним проходом.
+    struct IndexEntry {
+        size_t count;
+        Node* first;
+        long long firstPosition;
+    };
+    
+    bool indexEnabled;
+    mutable bool positionsStale;
+    mutable long long positionShift;
+    mutable std::unordered_map<std::string, IndexEntry> valueIndex;
+    
+    Node* nodeAt(size_t index) const;
+    void resetCursor() const;
+    
+    void indexAdd(Node* node, size_t position);
+    void indexRemove(Node* node);
+    void rebuildPositions() const;
+    // Пересчитывает число вхождений по списку, пропуская узел skip
+    void rebuildIndex(const Node* skip) const;
 
 public:
+    template<bool IsConst>
+    class Iterator {
+    private:
+        using NodePtr = typename std::conditional<IsConst, const Node*, Node*>::type;
+        
+        NodePtr node;
+        
+        Iterator(NodePtr current) : node(current) {}
+        
+        friend class SinglyLinkedList;
+        friend class Iterator<!IsConst>;
+    
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const std::string*, std::string*>::type;
+        using reference = typename std::conditional<IsConst, const std::string&, std::string&>::type;
+        
+        Iterator() : node(nullptr) {}
+        
+        // iterator неявно приводится к const_iterator
+        operator Iterator<true>() const {
+            return Iterator<true>(node);
+        }
+        
+        reference operator*() const {
+            return node->data;
+        }
+        
+        pointer operator->() const {
+            return &node->data;
+        }
+        
+        Iterator& operator++() {
+            node = node->next;
+            return *this;
+        }
+        
+        Iterator operator++(int) {
+            Iterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+        
+        bool operator==(const Iterator& other) const {
+            return node == other.node;
+        }
+        
+        bool operator!=(const Iterator& other) const {
+            return node != other.node;
+        }
+    };
+    
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    
     SinglyLinkedList();
     ~SinglyLinkedList();
     SinglyLinkedList(const SinglyLinkedList& other);
@@ -34,11 +128,43 @@ public:
     size_t size() const;
     bool empty() const;
     
+    iterator begin() { return iterator(head); }
+    iterator end() { return iterator(nullptr); }
+    const_iterator begin() const { return const_iterator(head); }
+    const_iterator end() const { return const_iterator(nullptr); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    
+    // Обход всех элементов по порядку без копирования
+    template<typename Visitor>
+    void forEach(Visitor&& visit) const {
+        for (const Node* current = head; current != nullptr; current = current->next) {
+            visit(current->data);
+        }
+    }
+    
     // Новые методы для тестирования
     bool checkIntegrity() const;
     std::vector<std::string> toVector() const;
     bool contains(const std::string& value) const;
     
+    static constexpr size_t npos = static_cast<size_t>(-1);
+    
+    // Позиция первого вхождения или npos; с индексом - O(1) в среднем
+    size_t indexOf(const std::string& value) const;
+    size_t count(const std::string& value) const;
+    
+    // Индекс строится за O(n) и дальше поддерживается всеми изменениями списка.
+    // Запись через iterator в обход списка индекс сразу не видит: count и
+    // contains могут отставать, пока удаление или indexOf не наткнутся на
+    // незнакомое значение и не соберут индекс заново. Чтобы не ждать этого,
+    // после такой записи индекс стоит включить заново.
+    void enableValueIndex();
+    void disableValueIndex();
+    bool hasValueIndex() const;
+    // Приблизительный объем памяти индекса в байтах
+    size_t valueIndexMemoryUsage() const;
+    
     void clear();
     void print() const;
     
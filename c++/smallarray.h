@@ -0,0 +1,295 @@
+#ifndef SMALLARRAY_H
+#define SMALLARRAY_H
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "array.h"
+
+// Массив с встроенным буфером: первые N элементов хранятся прямо в объекте,
+// куча используется только когда элементов становится больше N. Для множества
+// маленьких массивов это убирает отдельное выделение памяти под элементы и
+// цепочку перевыделений 1 -> 2 -> 4.
+// Бинарная сериализация совместима с Array<T>.
+template<typename T = std::string, size_t N = 4>
+class SmallArray {
+    static_assert(N > 0, "SmallArray needs a non-empty inline buffer");
+
+private:
+    T inlineItems[N];
+    T* data;            // inlineItems или блок в куче
+    size_t capacity;
+    size_t currentSize;
+    
+    bool usesInline() const {
+        return data == inlineItems;
+    }
+    
+    void resize(size_t newCapacity) {
+        T* newData = (newCapacity <= N) ? inlineItems : new T[newCapacity];
+        if (newData == data) {
+            return;
+        }
+        for (size_t i = 0; i < currentSize; ++i) {
+            newData[i] = std::move(data[i]);
+        }
+        if (!usesInline()) {
+            delete[] data;
+        }
+        data = newData;
+        capacity = (newCapacity <= N) ? N : newCapacity;
+    }
+    
+    void growIfFull() {
+        if (currentSize >= capacity) {
+            resize(capacity * 2);
+        }
+    }
+    
+    // Забирает содержимое other; other остается пустым и встроенным
+    void takeFrom(SmallArray& other) {
+        if (other.usesInline()) {
+            for (size_t i = 0; i < other.currentSize; ++i) {
+                inlineItems[i] = std::move(other.inlineItems[i]);
+            }
+            data = inlineItems;
+            capacity = N;
+        } else {
+            data = other.data;
+            capacity = other.capacity;
+            other.data = other.inlineItems;
+            other.capacity = N;
+        }
+        currentSize = other.currentSize;
+        other.currentSize = 0;
+    }
+
+public:
+    SmallArray() : inlineItems(), data(inlineItems), capacity(N), currentSize(0) {}
+    
+    SmallArray(const SmallArray& other) : SmallArray() {
+        *this = other;
+    }
+    
+    SmallArray(SmallArray&& other) noexcept(std::is_nothrow_move_assignable<T>::value)
+        : inlineItems(), data(inlineItems), capacity(N), currentSize(0) {
+        takeFrom(other);
+    }
+    
+    SmallArray& operator=(const SmallArray& other) {
+        if (this != &other) {
+            clear();
+            reserve(other.currentSize);
+            for (size_t i = 0; i < other.currentSize; ++i) {
+                data[i] = other.data[i];
+            }
+            currentSize = other.currentSize;
+        }
+        return *this;
+    }
+    
+    SmallArray& operator=(SmallArray&& other) noexcept(std::is_nothrow_move_assignable<T>::value) {
+        if (this != &other) {
+            clear();
+            if (!usesInline()) {
+                delete[] data;
+                data = inlineItems;
+                capacity = N;
+            }
+            takeFrom(other);
+        }
+        return *this;
+    }
+    
+    ~SmallArray() {
+        if (!usesInline()) {
+            delete[] data;
+        }
+    }
+    
+    void insert(const T& value) {
+        growIfFull();
+        data[currentSize++] = value;
+    }
+    
+    void insert(T&& value) {
+        growIfFull();
+        data[currentSize++] = std::move(value);
+    }
+    
+    void insertAt(size_t index, const T& value) {
+        T copy(value);
+        insertAt(index, std::move(copy));
+    }
+    
+    void insertAt(size_t index, T&& value) {
+        if (index > currentSize) {
+            throw std::out_of_range("Index out of range");
+        }
+        growIfFull();
+        for (size_t i = currentSize; i > index; --i) {
+            data[i] = std::move(data[i - 1]);
+        }
+        data[index] = std::move(value);
+        currentSize++;
+    }
+    
+    void remove(size_t index) {
+        if (index >= currentSize) {
+            throw std::out_of_range("Index out of range");
+        }
+        for (size_t i = index; i + 1 < currentSize; ++i) {
+            data[i] = std::move(data[i + 1]);
+        }
+        currentSize--;
+    }
+    
+    T get(size_t index) const {
+        return at(index);
+    }
+    
+    const T& at(size_t index) const {
+        if (index >= currentSize) {
+            throw std::out_of_range("Index out of range");
+        }
+        return data[index];
+    }
+    
+    void set(size_t index, const T& value) {
+        if (index >= currentSize) {
+            throw std::out_of_range("Index out of range");
+        }
+        data[index] = value;
+    }
+    
+    void set(size_t index, T&& value) {
+        if (index >= currentSize) {
+            throw std::out_of_range("Index out of range");
+        }
+        data[index] = std::move(value);
+    }
+    
+    // Сортировка по возрастанию; строки - той же MSD radix сортировкой, что
+    // и Array::sort(), но в одном потоке: массивы здесь маленькие
+    void sort() {
+        if (currentSize < 2) {
+            return;
+        }
+        if constexpr (std::is_same<T, std::string>::value) {
+            // Рабочая память под встроенные элементы - на стеке, без кучи
+            T inlineBuffer[N];
+            std::unique_ptr<T[]> heapBuffer;
+            T* buffer = inlineBuffer;
+            if (currentSize > N) {
+                heapBuffer.reset(new T[currentSize]);
+                buffer = heapBuffer.get();
+            }
+            Array<std::string>::radixSort(data, buffer, currentSize, 0);
+        } else {
+            std::stable_sort(data, data + currentSize);
+        }
+    }
+    
+    // Только для строк: индексы элементов, содержащих pattern (поиск как в Array::findAll)
+    std::vector<size_t> findAll(const std::string& pattern) const {
+        static_assert(std::is_same<T, std::string>::value, "findAll requires SmallArray<std::string>");
+        std::vector<size_t> result;
+        for (size_t i = 0; i < currentSize; ++i) {
+            if (Array<std::string>::containsPattern(data[i], pattern)) {
+                result.push_back(i);
+            }
+        }
+        return result;
+    }
+    
+    size_t size() const {
+        return currentSize;
+    }
+    
+    bool empty() const {
+        return currentSize == 0;
+    }
+    
+    void reserve(size_t newCapacity) {
+        if (newCapacity > capacity) {
+            resize(newCapacity);
+        }
+    }
+    
+    // Возвращает элементы во встроенный буфер, если они туда помещаются
+    void shrinkToFit() {
+        if (!usesInline() && capacity != currentSize) {
+            resize(currentSize);
+        }
+    }
+    
+    size_t getCapacity() const {
+        return capacity;
+    }
+    
+    // true, пока элементы лежат во встроенном буфере
+    bool isInline() const {
+        return usesInline();
+    }
+    
+    void clear() {
+        currentSize = 0;
+    }
+    
+    void print() const {
+        std::cout << "[";
+        for (size_t i = 0; i < currentSize; ++i) {
+            if constexpr (std::is_same<T, std::string>::value) {
+                std::cout << "\"" << data[i] << "\"";
+            } else {
+                std::cout << data[i];
+            }
+            if (i < currentSize - 1) std::cout << ", ";
+        }
+        std::cout << "]" << std::endl;
+    }
+    
+    // Бинарная сериализация (совместима с Array<T>)
+    void serialize(std::ostream& os) const {
+        os.write(reinterpret_cast<const char*>(&currentSize), sizeof(currentSize));
+        if constexpr (std::is_same<T, std::string>::value) {
+            for (size_t i = 0; i < currentSize; ++i) {
+                size_t strLen = data[i].length();
+                os.write(reinterpret_cast<const char*>(&strLen), sizeof(strLen));
+                os.write(data[i].c_str(), strLen);
+            }
+        } else {
+            static_assert(std::is_trivially_copyable<T>::value,
+                          "binary serialization requires std::string or a trivially copyable T");
+            os.write(reinterpret_cast<const char*>(data), currentSize * sizeof(T));
+        }
+    }
+    
+    void deserialize(std::istream& is) {
+        size_t arrSize = 0;
+        is.read(reinterpret_cast<char*>(&arrSize), sizeof(arrSize));
+        
+        clear();
+        reserve(arrSize);
+        if constexpr (std::is_same<T, std::string>::value) {
+            for (size_t i = 0; i < arrSize; ++i) {
+                size_t strLen;
+                is.read(reinterpret_cast<char*>(&strLen), sizeof(strLen));
+                data[i].resize(strLen);
+                is.read(&data[i][0], strLen);
+            }
+        } else {
+            static_assert(std::is_trivially_copyable<T>::value,
+                          "binary serialization requires std::string or a trivially copyable T");
+            is.read(reinterpret_cast<char*>(data), arrSize * sizeof(T));
+        }
+        currentSize = arrSize;
+    }
+};
+
+#endif
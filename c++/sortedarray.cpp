@@ -0,0 +1,128 @@
+#include "sortedarray.h"
+#include <stdexcept>
+
+SortedArray::SortedArray() : items() {}
+
+bool SortedArray::isSorted() const {
+    for (size_t i = 1; i < items.size(); ++i) {
+        if (items.at(i) < items.at(i - 1)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void SortedArray::restoreOrder() {
+    if (!isSorted()) {
+        items.sort();
+    }
+}
+
+size_t SortedArray::insertSorted(const std::string& value) {
+    size_t pos = upperBound(value);
+    items.insertAt(pos, value);
+    return pos;
+}
+
+size_t SortedArray::insertSorted(std::string&& value) {
+    size_t pos = upperBound(value);
+    items.insertAt(pos, std::move(value));
+    return pos;
+}
+
+size_t SortedArray::lowerBound(const std::string& value) const {
+    size_t low = 0;
+    size_t high = items.size();
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (items.at(mid) < value) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+size_t SortedArray::upperBound(const std::string& value) const {
+    size_t low = 0;
+    size_t high = items.size();
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (value < items.at(mid)) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return low;
+}
+
+std::pair<size_t, size_t> SortedArray::equalRange(const std::string& value) const {
+    return std::make_pair(lowerBound(value), upperBound(value));
+}
+
+bool SortedArray::contains(const std::string& value) const {
+    size_t pos = lowerBound(value);
+    return pos < items.size() && items.at(pos) == value;
+}
+
+size_t SortedArray::count(const std::string& value) const {
+    std::pair<size_t, size_t> range = equalRange(value);
+    return range.second - range.first;
+}
+
+bool SortedArray::erase(const std::string& value) {
+    size_t pos = lowerBound(value);
+    if (pos < items.size() && items.at(pos) == value) {
+        items.remove(pos);
+        return true;
+    }
+    return false;
+}
+
+void SortedArray::remove(size_t index) {
+    items.remove(index);
+}
+
+std::string SortedArray::get(size_t index) const {
+    return items.get(index);
+}
+
+const std::string& SortedArray::at(size_t index) const {
+    return items.at(index);
+}
+
+size_t SortedArray::size() const {
+    return items.size();
+}
+
+bool SortedArray::empty() const {
+    return items.empty();
+}
+
+void SortedArray::clear() {
+    items.clear();
+}
+
+void SortedArray::print() const {
+    items.print();
+}
+
+void SortedArray::serialize(std::ostream& os) const {
+    items.serialize(os);
+}
+
+void SortedArray::deserialize(std::istream& is) {
+    items.deserialize(is);
+    restoreOrder();
+}
+
+void SortedArray::serializeText(std::ostream& os) const {
+    items.serializeText(os);
+}
+
+void SortedArray::deserializeText(std::istream& is) {
+    items.deserializeText(is);
+    restoreOrder();
+}
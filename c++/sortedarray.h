@@ -0,0 +1,52 @@
+#ifndef SORTEDARRAY_H
+#define SORTEDARRAY_H
+
+#include "array.h"
+#include <iostream>
+#include <string>
+#include <utility>
+
+// Упорядоченный массив строк поверх Array: поиск по значению двоичным
+// поиском за O(log n), вставка сохраняет порядок (равные значения идут
+// в порядке добавления).
+class SortedArray {
+private:
+    Array<std::string> items;
+    
+    bool isSorted() const;
+    void restoreOrder();
+
+public:
+    SortedArray();
+    
+    size_t insertSorted(const std::string& value);
+    size_t insertSorted(std::string&& value);
+    
+    // Первая позиция со значением >= value / > value
+    size_t lowerBound(const std::string& value) const;
+    size_t upperBound(const std::string& value) const;
+    // Полуинтервал [first, second) равных value элементов
+    std::pair<size_t, size_t> equalRange(const std::string& value) const;
+    bool contains(const std::string& value) const;
+    size_t count(const std::string& value) const;
+    
+    // Удаляет одно вхождение value; false, если его нет
+    bool erase(const std::string& value);
+    void remove(size_t index);
+    std::string get(size_t index) const;
+    const std::string& at(size_t index) const;
+    size_t size() const;
+    bool empty() const;
+    
+    void clear();
+    void print() const;
+    
+    // Формат совпадает с Array; при загрузке порядок восстанавливается
+    void serialize(std::ostream& os) const;
+    void deserialize(std::istream& is);
+    
+    void serializeText(std::ostream& os) const;
+    void deserializeText(std::istream& is);
+};
+
+#endif
@@ -1,38 +1,45 @@
 #include "stack.h"
 #include <stdexcept>
+#include <utility>
 
-Stack::Stack() : list() {}
+Stack::Stack() : items() {}
 
 void Stack::push(const std::string& value) {
-    list.push_back(value);
+    items.insert(value);
+}
+
+void Stack::push(std::string&& value) {
+    items.insert(std::move(value));
 }
 
 std::string Stack::pop() {
     if (empty()) {
         throw std::runtime_error("Stack is empty");
     }
-    std::string value = list.get(list.size() - 1);
-    list.pop_back();
-    return value;
+    return items.popBack();
 }
 
-std::string Stack::top() const {
+const std::string& Stack::top() const {
     if (empty()) {
         throw std::runtime_error("Stack is empty");
     }
-    return list.get(list.size() - 1);
+    return items.at(items.size() - 1);
 }
 
 bool Stack::empty() const {
-    return list.empty();
+    return items.empty();
 }
 
 size_t Stack::size() const {
-    return list.size();
+    return items.size();
+}
+
+void Stack::reserve(size_t capacity) {
+    items.reserve(capacity);
 }
 
 void Stack::clear() {
-    list.clear();
+    items.clear();
 }
 
 void Stack::print() const {
@@ -42,25 +49,25 @@ void Stack::print() const {
     }
     
     std::cout << "Stack: [";
-    for (size_t i = 0; i < list.size(); ++i) {
-        std::cout << "\"" << list.get(i) << "\"";
-        if (i < list.size() - 1) std::cout << " | ";
+    for (size_t i = 0; i < items.size(); ++i) {
+        std::cout << "\"" << items.at(i) << "\"";
+        if (i < items.size() - 1) std::cout << " | ";
     }
     std::cout << "]" << std::endl;
 }
 
 void Stack::serialize(std::ostream& os) const {
-    list.serialize(os);
+    items.serialize(os);
 }
 
 void Stack::deserialize(std::istream& is) {
-    list.deserialize(is);
+    items.deserialize(is);
 }
 
 void Stack::serializeText(std::ostream& os) const {
-    list.serializeText(os);
+    items.serializeText(os);
 }
 
 void Stack::deserializeText(std::istream& is) {
-    list.deserializeText(is);
+    items.deserializeText(is);
 }
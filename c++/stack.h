@@ -1,24 +1,31 @@
 #ifndef STACK_H
 #define STACK_H
 
-#include "singlylinkedlist.h"
+#include "array.h"
 #include <string>
 #include <iostream>
 #include <stdexcept>
 
+// Стек поверх непрерывного Array: вершина - последний элемент, поэтому
+// push/pop/top выполняются за O(1) (push - амортизированно).
+// Формат сериализации прежний: элементы от дна к вершине.
 class Stack {
 private:
-    SinglyLinkedList list;
+    Array<std::string> items;
 
 public:
     Stack();
     
     void push(const std::string& value);
+    void push(std::string&& value);
+    // Извлекает вершину перемещением, без копирования строки
     std::string pop();
-    std::string top() const;
+    const std::string& top() const;
     bool empty() const;
     size_t size() const;
     
+    void reserve(size_t capacity);
+    
     void clear();
     void print() const;
     
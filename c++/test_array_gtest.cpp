@@ -2,15 +2,38 @@
 #include <sstream>
 #include <vector>
 #include <algorithm>
+#include <iterator>
 #include <stdexcept>
 #include <typeinfo>
+#include <random>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <fstream>
+#include <cstdio>
 #include "array.h"
+#include "arenaarray.h"
+#include "tieredarray.h"
+#include "sortedarray.h"
+#include "cowarray.h"
+#include "mappedarray.h"
+#include "smallarray.h"
+#include "nodepool.h"
 #include "singlylinkedlist.h"
 #include "doublylinkedlist.h"
+#include "unrolledlist.h"
+#include "indexedlist.h"
+#include "intrusivelist.h"
+#include "compactlist.h"
 #include "queue.h"
+#include "mpmcqueue.h"
+#include "blockingqueue.h"
 #include "stack.h"
+#include "concurrentstack.h"
+#include "workstealingdeque.h"
 #include "hashtable.h"
 #include "tree.h"
+#include "serializationutils.h"
 
 using namespace std;
 
@@ -27,7 +50,7 @@ protected:
         arr_.clear();
     }
     
-    Array arr_;
+    Array<std::string> arr_;
 };
 
 class LinkedListTest : public ::testing::Test {
@@ -518,6 +541,1036 @@ TEST_F(ArrayTest, StressTest) {
     EXPECT_GE(arr.size(), 0);
 }
 
+TEST_F(ArrayTest, MoveConstructorAndAssignment) {
+    Array moved(std::move(arr_));
+    EXPECT_EQ(moved.size(), 3);
+    EXPECT_EQ(moved.get(2), "three");
+    EXPECT_TRUE(arr_.empty());
+    
+    Array assigned;
+    assigned.insert("old");
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.size(), 3);
+    EXPECT_EQ(assigned.get(0), "one");
+    EXPECT_TRUE(moved.empty());
+    
+    moved.insert("reused");
+    EXPECT_EQ(moved.get(0), "reused");
+}
+
+TEST_F(ArrayTest, RvalueAndEmplaceOperations) {
+    Array arr;
+    string longValue(100, 'x');
+    arr.insert(std::move(longValue));
+    arr.insertAt(0, string(50, 'y'));
+    arr.emplace(3, 'z');
+    arr.emplaceAt(1, "abcdef", 3);
+    
+    ASSERT_EQ(arr.size(), 4);
+    EXPECT_EQ(arr.get(0), string(50, 'y'));
+    EXPECT_EQ(arr.get(1), "abc");
+    EXPECT_EQ(arr.get(2), string(100, 'x'));
+    EXPECT_EQ(arr.get(3), "zzz");
+    
+    arr.set(3, string(70, 'w'));
+    EXPECT_EQ(arr.get(3), string(70, 'w'));
+    
+    EXPECT_THROW(arr.insertAt(10, string("bad")), out_of_range);
+    EXPECT_THROW(arr.emplaceAt(10, "bad"), out_of_range);
+    EXPECT_THROW(arr.set(10, string("bad")), out_of_range);
+}
+
+TEST_F(ArrayTest, InsertRangeOperations) {
+    vector<string> batch = {"a", "b", "c"};
+    arr_.insertRange(1, batch.begin(), batch.end());
+    
+    ASSERT_EQ(arr_.size(), 6);
+    EXPECT_EQ(arr_.get(0), "one");
+    EXPECT_EQ(arr_.get(1), "a");
+    EXPECT_EQ(arr_.get(3), "c");
+    EXPECT_EQ(arr_.get(4), "two");
+    EXPECT_EQ(arr_.get(5), "three");
+    
+    arr_.insertRange(arr_.size(), batch.begin(), batch.begin() + 1);
+    EXPECT_EQ(arr_.get(6), "a");
+    arr_.insertRange(0, batch.end(), batch.end());
+    EXPECT_EQ(arr_.size(), 7);
+    
+    EXPECT_THROW(arr_.insertRange(100, batch.begin(), batch.end()), out_of_range);
+}
+
+TEST_F(ArrayTest, RemoveRangeAndRemoveIf) {
+    for (int i = 0; i < 7; i++) {
+        arr_.insert("x" + to_string(i));
+    }
+    arr_.removeRange(1, 3);
+    ASSERT_EQ(arr_.size(), 8);
+    EXPECT_EQ(arr_.get(0), "one");
+    EXPECT_EQ(arr_.get(1), "x0");
+    
+    size_t removed = arr_.removeIf([](const string& value) {
+        return value[0] == 'x' && (value[1] - '0') % 2 == 0;
+    });
+    EXPECT_EQ(removed, 4);
+    ASSERT_EQ(arr_.size(), 4);
+    EXPECT_EQ(arr_.get(1), "x1");
+    EXPECT_EQ(arr_.get(3), "x5");
+    
+    arr_.removeRange(2, 2);
+    EXPECT_EQ(arr_.size(), 4);
+    arr_.removeRange(0, arr_.size());
+    EXPECT_TRUE(arr_.empty());
+    
+    EXPECT_THROW(arr_.removeRange(0, 1), out_of_range);
+    EXPECT_THROW(arr_.removeRange(1, 0), out_of_range);
+}
+
+TEST_F(ArrayTest, ReserveAndShrinkToFit) {
+    arr_.reserve(100);
+    EXPECT_EQ(arr_.getCapacity(), 100);
+    EXPECT_EQ(arr_.get(2), "three");
+    
+    arr_.reserve(10);
+    EXPECT_EQ(arr_.getCapacity(), 100);
+    
+    arr_.shrinkToFit();
+    EXPECT_EQ(arr_.getCapacity(), 3);
+    EXPECT_EQ(arr_.get(0), "one");
+    
+    arr_.clear();
+    arr_.shrinkToFit();
+    EXPECT_EQ(arr_.getCapacity(), 0);
+    arr_.insert("again");
+    EXPECT_EQ(arr_.get(0), "again");
+}
+
+TEST_F(ArrayTest, SortSmallAndSpecialStrings) {
+    arr_.sort();
+    EXPECT_EQ(arr_.get(0), "one");
+    EXPECT_EQ(arr_.get(1), "three");
+    EXPECT_EQ(arr_.get(2), "two");
+    
+    Array arr;
+    arr.sort();
+    EXPECT_TRUE(arr.empty());
+    
+    // Пустые строки, общие префиксы и байты больше 127
+    vector<string> values = {"abc", "", "ab", "abcd", "\xff", "abc", "b", "", "a\x80", "aa"};
+    for (int i = 0; i < 10; ++i) {
+        for (const auto& value : values) {
+            arr.insert(value + (i % 2 ? "" : "z"));
+        }
+    }
+    vector<string> expected;
+    for (size_t i = 0; i < arr.size(); ++i) {
+        expected.push_back(arr.get(i));
+    }
+    std::sort(expected.begin(), expected.end());
+    
+    arr.sort(3);
+    ASSERT_EQ(arr.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(arr.get(i), expected[i]);
+    }
+}
+
+TEST_F(ArrayTest, SortLongRunWithSharedPrefix) {
+    // Больше порога вставок и общий первый байт: radix переходит к следующему байту
+    Array arr;
+    vector<string> expected;
+    for (int i = 0; i < 100; ++i) {
+        string value = "k" + to_string((i * 37) % 50);
+        arr.insert(value);
+        expected.push_back(value);
+    }
+    std::sort(expected.begin(), expected.end());
+    
+    arr.sort(1);
+    ASSERT_EQ(arr.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(arr.at(i), expected[i]);
+    }
+}
+
+TEST_F(ArrayTest, ParallelSortMatchesStdSort) {
+    mt19937 gen(42);
+    uniform_int_distribution<int> length(0, 12);
+    uniform_int_distribution<int> letter('a', 'd');
+    
+    Array arr;
+    vector<string> expected;
+    for (int i = 0; i < 5000; ++i) {
+        string value;
+        int len = length(gen);
+        for (int j = 0; j < len; ++j) {
+            value += static_cast<char>(letter(gen));
+        }
+        arr.insert(value);
+        expected.push_back(value);
+    }
+    std::sort(expected.begin(), expected.end());
+    
+    Array copy(arr);
+    Array comparatorCopy(arr);
+    arr.sort(4);
+    copy.sort(7);
+    comparatorCopy.sort([](const string& a, const string& b) { return a > b; }, 5);
+    
+    ASSERT_EQ(arr.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(arr.at(i), expected[i]);
+        EXPECT_EQ(copy.at(i), expected[i]);
+        EXPECT_EQ(comparatorCopy.at(i), expected[expected.size() - 1 - i]);
+    }
+    
+    // После сортировки массив остается рабочим
+    arr.insert("tail");
+    EXPECT_EQ(arr.get(arr.size() - 1), "tail");
+}
+
+TEST_F(ArrayTest, StableSortKeepsEqualOrder) {
+    Array arr;
+    for (int i = 0; i < 3000; ++i) {
+        arr.insert(string(static_cast<size_t>(i % 7), 'x') + "#" + to_string(i));
+    }
+    
+    auto byLength = [](const string& a, const string& b) {
+        return a.find('#') < b.find('#');
+    };
+    arr.stableSort(byLength, 4);
+    
+    for (size_t i = 1; i < arr.size(); ++i) {
+        const string& prev = arr.at(i - 1);
+        const string& cur = arr.at(i);
+        ASSERT_LE(prev.find('#'), cur.find('#'));
+        if (prev.find('#') == cur.find('#')) {
+            EXPECT_LT(stoi(prev.substr(prev.find('#') + 1)), stoi(cur.substr(cur.find('#') + 1)));
+        }
+    }
+}
+
+TEST_F(ArrayTest, FindAllAndFindPrefix) {
+    arr_.insert("");
+    arr_.insert("prefix-one-two");
+    
+    vector<size_t> found = arr_.findAll("o");
+    EXPECT_EQ(found, (vector<size_t>{0, 1, 4}));
+    EXPECT_EQ(arr_.findAll("one"), (vector<size_t>{0, 4}));
+    EXPECT_EQ(arr_.findAll("").size(), arr_.size());
+    EXPECT_TRUE(arr_.findAll("missing").empty());
+    EXPECT_TRUE(arr_.findAll("prefix-one-two-three").empty());
+    
+    EXPECT_EQ(arr_.findPrefix("t"), (vector<size_t>{1, 2}));
+    EXPECT_EQ(arr_.findPrefix("prefix"), (vector<size_t>{4}));
+    EXPECT_EQ(arr_.findPrefix("").size(), arr_.size());
+    EXPECT_TRUE(arr_.findPrefix("one-").empty());
+}
+
+TEST_F(ArrayTest, FindAllMatchesStringFind) {
+    // Длинные строки проходят через векторные блоки и скалярный хвост
+    mt19937 gen(7);
+    uniform_int_distribution<int> length(0, 100);
+    uniform_int_distribution<int> letter('a', 'c');
+    
+    Array arr;
+    vector<string> values;
+    for (int i = 0; i < 500; ++i) {
+        string value;
+        int len = length(gen);
+        for (int j = 0; j < len; ++j) {
+            value += static_cast<char>(letter(gen));
+        }
+        arr.insert(value);
+        values.push_back(value);
+    }
+    
+    vector<string> patterns = {"a", "ab", "cab", "abca", "aaaa", "abcabcab", "ccccccccccccccccc"};
+    for (const auto& pattern : patterns) {
+        vector<size_t> expected;
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (values[i].find(pattern) != string::npos) {
+                expected.push_back(i);
+            }
+        }
+        EXPECT_EQ(arr.findAll(pattern), expected) << "pattern: " << pattern;
+    }
+    
+    // Совпадение на самом конце строки за границей 16/32 байт
+    Array edge;
+    edge.insert(string(47, 'x') + "yz");
+    edge.insert(string(48, 'x') + "y");
+    EXPECT_EQ(edge.findAll("yz"), (vector<size_t>{0}));
+    EXPECT_EQ(edge.findAll("xy"), (vector<size_t>{0, 1}));
+}
+
+// ==================== GENERIC ARRAY TESTS ====================
+struct GridPoint {
+    int x;
+    double weight;
+};
+
+TEST(GenericArrayTest, IntOperations) {
+    Array<int> arr;
+    for (int i = 0; i < 1000; ++i) {
+        arr.insert(i);
+    }
+    arr.insertAt(0, -1);
+    arr.emplace(1000);
+    arr.remove(500);
+    
+    ASSERT_EQ(arr.size(), 1001);
+    EXPECT_EQ(arr.get(0), -1);
+    EXPECT_EQ(arr.at(500), 500);
+    EXPECT_EQ(arr.at(1000), 1000);
+    EXPECT_THROW(arr.get(1001), out_of_range);
+    
+    vector<int> extra = {7, 8, 9};
+    arr.insertRange(1, extra.begin(), extra.end());
+    EXPECT_EQ(arr.at(2), 8);
+    arr.removeRange(1, 4);
+    EXPECT_EQ(arr.removeIf([](int value) { return value % 2 != 0; }), 500);
+    EXPECT_EQ(arr.at(0), 0);
+    
+    Array<int> copy(arr);
+    arr.set(0, 42);
+    EXPECT_EQ(copy.get(0), 0);
+    
+    Array<int> sized(3);
+    EXPECT_EQ(sized.get(2), 0);
+    sized.shrinkToFit();
+    EXPECT_EQ(sized.getCapacity(), 3);
+}
+
+TEST(GenericArrayTest, SortInts) {
+    mt19937 gen(3);
+    Array<int> arr;
+    vector<int> expected;
+    for (int i = 0; i < 4000; ++i) {
+        int value = static_cast<int>(gen() % 1000) - 500;
+        arr.insert(value);
+        expected.push_back(value);
+    }
+    std::sort(expected.begin(), expected.end());
+    
+    Array<int> descending(arr);
+    arr.sort(4);
+    descending.sort([](const int& a, const int& b) { return a > b; }, 3);
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(arr.at(i), expected[i]);
+        EXPECT_EQ(descending.at(i), expected[expected.size() - 1 - i]);
+    }
+}
+
+TEST(GenericArrayTest, TrivialBlockSerialization) {
+    Array<GridPoint> arr;
+    for (int i = 0; i < 100; ++i) {
+        arr.insert(GridPoint{i, i * 0.5});
+    }
+    
+    stringstream ss;
+    arr.serialize(ss);
+    EXPECT_EQ(ss.str().size(), sizeof(size_t) + 100 * sizeof(GridPoint));
+    
+    Array<GridPoint> loaded;
+    loaded.insert(GridPoint{-1, -1.0});
+    loaded.deserialize(ss);
+    ASSERT_EQ(loaded.size(), 100);
+    EXPECT_EQ(loaded.at(99).x, 99);
+    EXPECT_DOUBLE_EQ(loaded.at(99).weight, 49.5);
+    
+    Array<double> values;
+    values.insert(1.5);
+    values.insert(-2.25);
+    stringstream text;
+    values.serializeText(text);
+    Array<double> fromText;
+    fromText.deserializeText(text);
+    ASSERT_EQ(fromText.size(), 2);
+    EXPECT_DOUBLE_EQ(fromText.get(1), -2.25);
+}
+
+TEST(GenericArrayTest, NonTrivialElements) {
+    Array<vector<int>> arr;
+    arr.insert(vector<int>{1, 2, 3});
+    arr.emplace(2, 7);
+    arr.insertAt(0, vector<int>());
+    
+    ASSERT_EQ(arr.size(), 3);
+    EXPECT_TRUE(arr.at(0).empty());
+    EXPECT_EQ(arr.at(2), (vector<int>{7, 7}));
+    
+    Array<vector<int>> moved(std::move(arr));
+    EXPECT_TRUE(arr.empty());
+    moved.remove(0);
+    EXPECT_EQ(moved.at(0).size(), 3);
+}
+
+// ==================== ARENA ARRAY TESTS ====================
+TEST(ArenaArrayTest, BasicOperations) {
+    ArenaArray arr;
+    EXPECT_TRUE(arr.empty());
+    
+    arr.insert("one");
+    arr.insert("three");
+    arr.insertAt(1, "two");
+    arr.insertAt(0, "");
+    
+    ASSERT_EQ(arr.size(), 4);
+    EXPECT_EQ(arr.get(0), "");
+    EXPECT_EQ(arr.get(1), "one");
+    EXPECT_EQ(arr.view(2), "two");
+    EXPECT_EQ(arr.view(3), "three");
+    
+    arr.remove(0);
+    EXPECT_EQ(arr.size(), 3);
+    EXPECT_EQ(arr.get(0), "one");
+    
+    EXPECT_THROW(arr.get(3), out_of_range);
+    EXPECT_THROW(arr.view(3), out_of_range);
+    EXPECT_THROW(arr.insertAt(5, "bad"), out_of_range);
+    EXPECT_THROW(arr.remove(3), out_of_range);
+    EXPECT_THROW(arr.set(3, "bad"), out_of_range);
+}
+
+TEST(ArenaArrayTest, SetShrinkGrowAndAlias) {
+    ArenaArray arr;
+    arr.insert("short");
+    arr.insert("another value");
+    
+    arr.set(0, "s");
+    EXPECT_EQ(arr.get(0), "s");
+    arr.set(0, "a much longer replacement value");
+    EXPECT_EQ(arr.get(0), "a much longer replacement value");
+    
+    // Значение из той же арены переживает перевыделение буфера
+    for (int i = 0; i < 100; i++) {
+        arr.set(1, arr.view(0));
+        arr.insert(arr.view(1));
+    }
+    EXPECT_EQ(arr.get(1), "a much longer replacement value");
+    EXPECT_EQ(arr.get(arr.size() - 1), "a much longer replacement value");
+}
+
+TEST(ArenaArrayTest, CompactionKeepsValues) {
+    ArenaArray arr;
+    for (int i = 0; i < 2000; i++) {
+        arr.insert("value_" + to_string(i));
+    }
+    size_t before = arr.memoryUsage();
+    for (int i = 0; i < 1500; i++) {
+        arr.remove(0);
+    }
+    for (size_t i = 0; i < arr.size(); i++) {
+        arr.set(i, "v" + to_string(i));
+    }
+    arr.compact();
+    
+    ASSERT_EQ(arr.size(), 500);
+    EXPECT_EQ(arr.get(0), "v0");
+    EXPECT_EQ(arr.get(499), "v499");
+    EXPECT_LT(arr.memoryUsage(), before);
+}
+
+TEST(ArenaArrayTest, CopyAndMove) {
+    ArenaArray arr;
+    arr.insert("alpha");
+    arr.insert("beta");
+    arr.remove(0);
+    
+    ArenaArray copy(arr);
+    ASSERT_EQ(copy.size(), 1);
+    EXPECT_EQ(copy.get(0), "beta");
+    copy.set(0, "changed");
+    EXPECT_EQ(arr.get(0), "beta");
+    
+    ArenaArray moved(std::move(copy));
+    EXPECT_EQ(moved.get(0), "changed");
+    EXPECT_TRUE(copy.empty());
+    
+    arr = moved;
+    EXPECT_EQ(arr.get(0), "changed");
+    arr = std::move(moved);
+    EXPECT_EQ(arr.size(), 1);
+}
+
+TEST(ArenaArrayTest, SerializationCompatibleWithArray) {
+    Array original;
+    original.insert("first");
+    original.insert("");
+    original.insert("multi\nline");
+    original.insert(string(300, 'x'));
+    
+    stringstream ss;
+    original.serialize(ss);
+    
+    ArenaArray arena;
+    arena.deserialize(ss);
+    ASSERT_EQ(arena.size(), 4);
+    EXPECT_EQ(arena.get(2), "multi\nline");
+    EXPECT_EQ(arena.get(3), string(300, 'x'));
+    
+    stringstream back;
+    arena.serialize(back);
+    Array restored;
+    restored.deserialize(back);
+    ASSERT_EQ(restored.size(), 4);
+    EXPECT_EQ(restored.get(0), "first");
+    EXPECT_EQ(restored.get(1), "");
+    
+    stringstream text;
+    arena.serializeText(text);
+    ArenaArray fromText;
+    fromText.deserializeText(text);
+    ASSERT_EQ(fromText.size(), 4);
+    EXPECT_EQ(fromText.get(2), "multi\nline");
+}
+
+TEST(ArenaArrayTest, PrintOperations) {
+    ArenaArray arr;
+    arr.insert("printed");
+    testing::internal::CaptureStdout();
+    arr.print();
+    string output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(output.find("\"printed\""), string::npos);
+}
+
+// ==================== TIERED ARRAY TESTS ====================
+TEST(TieredArrayTest, MatchesArrayUnderRandomEdits) {
+    TieredArray tiered;
+    Array reference;
+    mt19937 gen(42);
+    
+    for (int i = 0; i < 5000; i++) {
+        size_t size = reference.size();
+        int op = gen() % 4;
+        string value = "v" + to_string(i);
+        if (op < 2 || size == 0) {
+            size_t pos = gen() % (size + 1);
+            tiered.insertAt(pos, value);
+            reference.insertAt(pos, value);
+        } else if (op == 2) {
+            size_t pos = gen() % size;
+            tiered.remove(pos);
+            reference.remove(pos);
+        } else {
+            size_t pos = gen() % size;
+            tiered.set(pos, value);
+            reference.set(pos, value);
+        }
+    }
+    
+    ASSERT_EQ(tiered.size(), reference.size());
+    for (size_t i = 0; i < reference.size(); i++) {
+        ASSERT_EQ(tiered.get(i), reference.get(i));
+    }
+}
+
+TEST(TieredArrayTest, BlockSizeFollowsSqrtN) {
+    TieredArray arr;
+    EXPECT_EQ(arr.getBlockSize(), 8);
+    
+    for (int i = 0; i < 20000; i++) {
+        arr.insert(to_string(i));
+    }
+    size_t blockSize = arr.getBlockSize();
+    EXPECT_GE(blockSize * blockSize * 4, arr.size());
+    EXPECT_LE(blockSize * blockSize, arr.size() * 4);
+    EXPECT_EQ(arr.get(12345), "12345");
+    
+    while (arr.size() > 10) {
+        arr.remove(arr.size() / 2);
+    }
+    EXPECT_EQ(arr.getBlockSize(), 8);
+    EXPECT_EQ(arr.get(0), "0");
+    EXPECT_EQ(arr.get(9), "19999");
+    
+    while (!arr.empty()) {
+        arr.remove(0);
+    }
+    EXPECT_TRUE(arr.empty());
+    arr.insert("again");
+    EXPECT_EQ(arr.get(0), "again");
+}
+
+TEST(TieredArrayTest, ExceptionsAndCopies) {
+    TieredArray arr;
+    EXPECT_THROW(arr.get(0), out_of_range);
+    EXPECT_THROW(arr.remove(0), out_of_range);
+    EXPECT_THROW(arr.insertAt(1, "bad"), out_of_range);
+    EXPECT_THROW(arr.set(0, "bad"), out_of_range);
+    
+    for (int i = 0; i < 100; i++) {
+        arr.insertAt(0, to_string(i));
+    }
+    TieredArray copy(arr);
+    copy.set(0, "changed");
+    EXPECT_EQ(arr.get(0), "99");
+    EXPECT_EQ(copy.get(99), "0");
+    
+    TieredArray moved(std::move(copy));
+    EXPECT_EQ(moved.get(0), "changed");
+    EXPECT_TRUE(copy.empty());
+    
+    arr = moved;
+    EXPECT_EQ(arr.get(0), "changed");
+    moved.clear();
+    EXPECT_EQ(arr.size(), 100);
+}
+
+TEST(TieredArrayTest, SerializationCompatibleWithArray) {
+    TieredArray arr;
+    for (int i = 0; i < 50; i++) {
+        arr.insert("line_" + to_string(i));
+    }
+    arr.insertAt(10, "multi\nline \"quoted\"");
+    
+    stringstream ss;
+    arr.serialize(ss);
+    Array plain;
+    plain.deserialize(ss);
+    ASSERT_EQ(plain.size(), 51);
+    EXPECT_EQ(plain.get(10), "multi\nline \"quoted\"");
+    
+    stringstream back;
+    plain.serialize(back);
+    TieredArray restored;
+    restored.deserialize(back);
+    EXPECT_EQ(restored.get(50), "line_49");
+    
+    stringstream text;
+    arr.serializeText(text);
+    TieredArray fromText;
+    fromText.deserializeText(text);
+    ASSERT_EQ(fromText.size(), 51);
+    EXPECT_EQ(fromText.get(10), "multi\nline \"quoted\"");
+    
+    testing::internal::CaptureStdout();
+    fromText.print();
+    string output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(output.find("\"line_0\""), string::npos);
+}
+
+// ==================== SORTED ARRAY TESTS ====================
+TEST(SortedArrayTest, InsertKeepsOrder) {
+    SortedArray arr;
+    EXPECT_EQ(arr.insertSorted("m"), 0);
+    EXPECT_EQ(arr.insertSorted("c"), 0);
+    EXPECT_EQ(arr.insertSorted("x"), 2);
+    EXPECT_EQ(arr.insertSorted(string("m")), 2);
+    
+    ASSERT_EQ(arr.size(), 4);
+    EXPECT_EQ(arr.get(0), "c");
+    EXPECT_EQ(arr.at(1), "m");
+    EXPECT_EQ(arr.at(2), "m");
+    EXPECT_EQ(arr.get(3), "x");
+}
+
+TEST(SortedArrayTest, BinarySearchQueries) {
+    SortedArray arr;
+    for (const char* value : {"delta", "alpha", "charlie", "bravo", "charlie", "echo", "charlie"}) {
+        arr.insertSorted(value);
+    }
+    
+    EXPECT_TRUE(arr.contains("alpha"));
+    EXPECT_TRUE(arr.contains("echo"));
+    EXPECT_FALSE(arr.contains("foxtrot"));
+    EXPECT_FALSE(arr.contains("a"));
+    
+    EXPECT_EQ(arr.lowerBound("charlie"), 2);
+    EXPECT_EQ(arr.upperBound("charlie"), 5);
+    pair<size_t, size_t> range = arr.equalRange("charlie");
+    EXPECT_EQ(range.first, 2);
+    EXPECT_EQ(range.second, 5);
+    EXPECT_EQ(arr.count("charlie"), 3);
+    range = arr.equalRange("zulu");
+    EXPECT_EQ(range.first, 7);
+    EXPECT_EQ(range.second, 7);
+    EXPECT_EQ(arr.lowerBound(""), 0);
+    
+    EXPECT_TRUE(arr.erase("charlie"));
+    EXPECT_EQ(arr.count("charlie"), 2);
+    EXPECT_FALSE(arr.erase("zulu"));
+    arr.remove(0);
+    EXPECT_EQ(arr.get(0), "bravo");
+    EXPECT_THROW(arr.at(10), out_of_range);
+}
+
+TEST(SortedArrayTest, DeserializeRestoresOrder) {
+    Array unordered;
+    unordered.insert("pear");
+    unordered.insert("apple");
+    unordered.insert("fig");
+    EXPECT_EQ(unordered.at(1), "apple");
+    
+    stringstream ss;
+    unordered.serialize(ss);
+    SortedArray arr;
+    arr.deserialize(ss);
+    ASSERT_EQ(arr.size(), 3);
+    EXPECT_EQ(arr.get(0), "apple");
+    EXPECT_EQ(arr.get(2), "pear");
+    
+    stringstream text;
+    arr.serializeText(text);
+    SortedArray fromText;
+    fromText.deserializeText(text);
+    EXPECT_TRUE(fromText.contains("fig"));
+    
+    fromText.clear();
+    EXPECT_TRUE(fromText.empty());
+}
+
+// ==================== COW ARRAY TESTS ====================
+TEST(CowArrayTest, BasicOperations) {
+    CowArray arr;
+    EXPECT_TRUE(arr.empty());
+    for (int i = 0; i < 200; ++i) {
+        arr.insert(to_string(i));
+    }
+    arr.insertAt(0, "first");
+    arr.insertAt(100, string("middle"));
+    
+    ASSERT_EQ(arr.size(), 202);
+    EXPECT_EQ(arr.get(0), "first");
+    EXPECT_EQ(arr.at(1), "0");
+    EXPECT_EQ(arr.at(100), "middle");
+    EXPECT_EQ(arr.at(201), "199");
+    
+    arr.remove(100);
+    arr.remove(0);
+    arr.set(5, "five");
+    EXPECT_EQ(arr.size(), 200);
+    EXPECT_EQ(arr.at(5), "five");
+    EXPECT_EQ(arr.at(199), "199");
+    EXPECT_THROW(arr.get(200), out_of_range);
+    EXPECT_THROW(arr.insertAt(201, "x"), out_of_range);
+    EXPECT_THROW(arr.remove(200), out_of_range);
+    
+    while (!arr.empty()) {
+        arr.remove(arr.size() - 1);
+    }
+    arr.insert("again");
+    EXPECT_EQ(arr.get(0), "again");
+}
+
+TEST(CowArrayTest, SnapshotIsIsolatedAndSharesChunks) {
+    CowArray arr;
+    for (int i = 0; i < 300; ++i) {
+        arr.insert("value" + to_string(i));
+    }
+    
+    CowArray snap = arr.snapshot();
+    EXPECT_EQ(&snap.at(0), &arr.at(0));
+    
+    arr.set(0, "changed");
+    arr.insert("appended");
+    EXPECT_EQ(snap.at(0), "value0");
+    EXPECT_EQ(snap.size(), 300);
+    EXPECT_EQ(arr.at(0), "changed");
+    EXPECT_EQ(arr.size(), 301);
+    
+    // Блок с первым элементом скопирован, дальние блоки остались общими
+    EXPECT_NE(&snap.at(0), &arr.at(0));
+    EXPECT_EQ(&snap.at(250), &arr.at(250));
+    
+    CowArray copy(snap);
+    copy.remove(0);
+    EXPECT_EQ(copy.at(0), "value1");
+    EXPECT_EQ(snap.at(0), "value0");
+    
+    snap.clear();
+    EXPECT_EQ(arr.at(299), "value299");
+}
+
+TEST(CowArrayTest, SerializeSnapshotWhileWriting) {
+    CowArray arr;
+    for (int i = 0; i < 1000; ++i) {
+        arr.insert("item" + to_string(i));
+    }
+    
+    CowArray snap = arr.snapshot();
+    stringstream ss;
+    thread reader([&ss, snap]() {
+        snap.serialize(ss);
+    });
+    for (int i = 0; i < 1000; ++i) {
+        arr.set(static_cast<size_t>(i), "new" + to_string(i));
+    }
+    reader.join();
+    
+    Array loaded;
+    loaded.deserialize(ss);
+    ASSERT_EQ(loaded.size(), 1000);
+    EXPECT_EQ(loaded.get(0), "item0");
+    EXPECT_EQ(loaded.get(999), "item999");
+    EXPECT_EQ(arr.at(999), "new999");
+    
+    stringstream text;
+    arr.serializeText(text);
+    CowArray fromText;
+    fromText.deserializeText(text);
+    EXPECT_EQ(fromText.size(), 1000);
+    EXPECT_EQ(fromText.at(10), "new10");
+}
+
+// ==================== MAPPED ARRAY TESTS ====================
+TEST(MappedArrayTest, OpensMappedLayout) {
+    const string filename = "mapped_array_test.bin";
+    Array<string> arr;
+    arr.insert("alpha");
+    arr.insert("");
+    arr.insert(string("with\0zero", 9));
+    arr.insert("Text with \"quotes\"\nand newline");
+    ASSERT_TRUE(SerializationUtils::saveToMappedFile(arr, filename));
+    
+    MappedArray mapped(filename);
+    EXPECT_TRUE(mapped.isOpen());
+    ASSERT_EQ(mapped.size(), 4);
+    EXPECT_EQ(mapped.get(0), "alpha");
+    EXPECT_TRUE(mapped.get(1).empty());
+    EXPECT_EQ(mapped.get(2), string_view("with\0zero", 9));
+    EXPECT_EQ(mapped.get(3), arr.at(3));
+    EXPECT_THROW(mapped.get(4), out_of_range);
+    
+    MappedArray moved(std::move(mapped));
+    EXPECT_FALSE(mapped.isOpen());
+    EXPECT_EQ(moved.get(0), "alpha");
+    moved.close();
+    EXPECT_TRUE(moved.empty());
+    remove(filename.c_str());
+}
+
+TEST(MappedArrayTest, OpensArrayBinaryFile) {
+    const string filename = "mapped_array_plain.bin";
+    Array<string> arr;
+    for (int i = 0; i < 100; ++i) {
+        arr.insert("value" + to_string(i));
+    }
+    ASSERT_TRUE(SerializationUtils::saveToBinaryFile(arr, filename));
+    
+    MappedArray mapped;
+    mapped.open(filename);
+    ASSERT_EQ(mapped.size(), 100);
+    EXPECT_EQ(mapped.get(0), "value0");
+    EXPECT_EQ(mapped.get(99), "value99");
+    
+    Array<string> empty;
+    ASSERT_TRUE(SerializationUtils::saveToMappedFile(empty, filename));
+    mapped.open(filename);
+    EXPECT_TRUE(mapped.empty());
+    remove(filename.c_str());
+}
+
+TEST(MappedArrayTest, RejectsMissingAndTruncatedFiles) {
+    EXPECT_THROW(MappedArray("no_such_mapped_file.bin"), runtime_error);
+    
+    const string filename = "mapped_array_broken.bin";
+    Array<string> arr;
+    arr.insert("a long enough value");
+    ASSERT_TRUE(SerializationUtils::saveToBinaryFile(arr, filename));
+    {
+        // Обрезаем файл посреди строки
+        ifstream in(filename, ios::binary);
+        string bytes((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+        ofstream out(filename, ios::binary | ios::trunc);
+        out.write(bytes.data(), bytes.size() - 5);
+    }
+    MappedArray mapped;
+    EXPECT_THROW(mapped.open(filename), runtime_error);
+    EXPECT_FALSE(mapped.isOpen());
+    remove(filename.c_str());
+}
+
+// ==================== SMALL ARRAY TESTS ====================
+TEST(SmallArrayTest, StaysInlineUntilFull) {
+    SmallArray<string, 4> arr;
+    EXPECT_TRUE(arr.isInline());
+    EXPECT_EQ(arr.getCapacity(), 4);
+    
+    arr.insert("b");
+    arr.insert(string("d"));
+    arr.insertAt(0, "a");
+    arr.insertAt(2, "c");
+    EXPECT_TRUE(arr.isInline());
+    ASSERT_EQ(arr.size(), 4);
+    EXPECT_EQ(arr.get(0), "a");
+    EXPECT_EQ(arr.at(2), "c");
+    
+    arr.insert("e");
+    EXPECT_FALSE(arr.isInline());
+    EXPECT_EQ(arr.getCapacity(), 8);
+    EXPECT_EQ(arr.at(4), "e");
+    EXPECT_EQ(arr.at(0), "a");
+    
+    arr.remove(4);
+    arr.remove(0);
+    arr.shrinkToFit();
+    EXPECT_TRUE(arr.isInline());
+    EXPECT_EQ(arr.at(0), "b");
+    EXPECT_EQ(arr.at(2), "d");
+    
+    arr.set(1, "C");
+    EXPECT_EQ(arr.get(1), "C");
+    EXPECT_THROW(arr.get(3), out_of_range);
+    EXPECT_THROW(arr.insertAt(4, "x"), out_of_range);
+    EXPECT_THROW(arr.remove(3), out_of_range);
+}
+
+TEST(SmallArrayTest, CopyAndMoveInlineAndHeap) {
+    SmallArray<string, 2> small;
+    small.insert("one");
+    SmallArray<string, 2> large;
+    for (int i = 0; i < 10; ++i) {
+        large.insert(to_string(i));
+    }
+    
+    SmallArray<string, 2> smallCopy(small);
+    SmallArray<string, 2> largeCopy(large);
+    large.set(0, "changed");
+    EXPECT_EQ(smallCopy.at(0), "one");
+    EXPECT_EQ(largeCopy.at(0), "0");
+    EXPECT_EQ(largeCopy.size(), 10);
+    
+    SmallArray<string, 2> movedSmall(std::move(small));
+    SmallArray<string, 2> movedLarge(std::move(large));
+    EXPECT_TRUE(small.empty());
+    EXPECT_TRUE(small.isInline());
+    EXPECT_TRUE(large.empty());
+    EXPECT_TRUE(movedSmall.isInline());
+    EXPECT_EQ(movedSmall.at(0), "one");
+    EXPECT_FALSE(movedLarge.isInline());
+    EXPECT_EQ(movedLarge.at(0), "changed");
+    
+    movedLarge = std::move(movedSmall);
+    EXPECT_TRUE(movedLarge.isInline());
+    EXPECT_EQ(movedLarge.size(), 1);
+    largeCopy = movedLarge;
+    EXPECT_EQ(largeCopy.size(), 1);
+    EXPECT_EQ(largeCopy.at(0), "one");
+    
+    large.insert("reused");
+    EXPECT_EQ(large.at(0), "reused");
+}
+
+TEST(SmallArrayTest, SerializationMatchesArray) {
+    SmallArray<string, 3> arr;
+    for (const char* value : {"x", "", "with\nnewline", "spilled"}) {
+        arr.insert(value);
+    }
+    stringstream ss;
+    arr.serialize(ss);
+    Array<string> loaded;
+    loaded.deserialize(ss);
+    ASSERT_EQ(loaded.size(), 4);
+    EXPECT_EQ(loaded.get(2), "with\nnewline");
+    
+    stringstream back;
+    loaded.serialize(back);
+    SmallArray<string, 3> roundTrip;
+    roundTrip.deserialize(back);
+    EXPECT_EQ(roundTrip.at(3), "spilled");
+    
+    SmallArray<int, 8> numbers;
+    numbers.insert(5);
+    numbers.insert(-7);
+    stringstream raw;
+    numbers.serialize(raw);
+    Array<int> loadedNumbers;
+    loadedNumbers.deserialize(raw);
+    EXPECT_EQ(loadedNumbers.get(1), -7);
+}
+
+TEST(SmallArrayTest, SortAndFindAllMatchArray) {
+    std::mt19937 gen(11);
+    for (size_t count : {0, 1, 3, 4, 40, 200}) {
+        SmallArray<string, 4> small;
+        Array<string> array;
+        for (size_t i = 0; i < count; i++) {
+            string value = "k" + std::to_string(gen() % 50) + (i % 3 == 0 ? "ab" : "");
+            small.insert(value);
+            array.insert(value);
+        }
+        small.sort();
+        array.sort();
+        ASSERT_EQ(small.size(), array.size());
+        for (size_t i = 0; i < count; i++) {
+            EXPECT_EQ(small.at(i), array.at(i));
+        }
+        EXPECT_EQ(small.findAll("ab"), array.findAll("ab"));
+        EXPECT_EQ(small.findAll("1"), array.findAll("1"));
+    }
+    
+    SmallArray<int, 2> numbers;
+    numbers.insert(3);
+    numbers.insert(-1);
+    numbers.insert(2);
+    numbers.sort();
+    EXPECT_EQ(numbers.at(0), -1);
+    EXPECT_EQ(numbers.at(2), 3);
+}
+
+// ==================== NODE POOL TESTS ====================
+TEST(NodePoolTest, ReusesFreedNodes) {
+    NodePool<string> pool;
+    EXPECT_EQ(pool.slabCount(), 0);
+    
+    string* first = pool.create("first");
+    string* second = pool.create(5, 'x');
+    EXPECT_EQ(*first, "first");
+    EXPECT_EQ(*second, "xxxxx");
+    EXPECT_EQ(pool.slabCount(), 1);
+    
+    pool.destroy(first);
+    string* reused = pool.create("reused");
+    EXPECT_EQ(reused, first);
+    
+    // Блоки растут: 16, 32, ... узлов
+    vector<string*> nodes;
+    for (int i = 0; i < 100; ++i) {
+        nodes.push_back(pool.create(to_string(i)));
+    }
+    EXPECT_EQ(pool.slabCount(), 3);
+    EXPECT_EQ(*nodes[99], "99");
+    
+    for (string* node : nodes) {
+        pool.destroy(node);
+    }
+    pool.destroy(reused);
+    pool.destroy(second);
+    pool.releaseAll();
+    EXPECT_EQ(pool.slabCount(), 0);
+}
+
+TEST(NodePoolTest, ListsRecycleNodesUnderChurn) {
+    SinglyLinkedList singly;
+    DoublyLinkedList doubly;
+    for (int i = 0; i < 10000; ++i) {
+        singly.push_back(to_string(i));
+        doubly.push_front(to_string(i));
+        if (i % 3 != 0) {
+            singly.pop_front();
+            doubly.pop_back();
+        }
+    }
+    EXPECT_EQ(singly.size(), 3334);
+    EXPECT_EQ(doubly.size(), 3334);
+    EXPECT_TRUE(singly.checkIntegrity());
+    EXPECT_TRUE(doubly.checkIntegrity());
+    EXPECT_EQ(singly.get(0), "6666");
+    EXPECT_EQ(doubly.get(3333), "6666");
+    
+    singly.insert(1, "inserted");
+    singly.remove(0);
+    EXPECT_EQ(singly.get(0), "inserted");
+    
+    singly.clear();
+    doubly.clear();
+    singly.push_back("after clear");
+    doubly.push_back("after clear");
+    EXPECT_EQ(singly.get(0), "after clear");
+    EXPECT_EQ(doubly.get(0), "after clear");
+}
+
 // ==================== SINGLY LINKED LIST TESTS ====================
 TEST_F(LinkedListTest, DefaultConstructor) {
     SinglyLinkedList list;
@@ -808,6 +1861,149 @@ TEST_F(LinkedListTest, TextSerialization) {
     EXPECT_TRUE(loaded.checkIntegrity());
 }
 
+TEST(SinglyLinkedListTest, ValueIndexLookups) {
+    SinglyLinkedList list;
+    for (int i = 0; i < 10; i++) {
+        list.push_back("v" + std::to_string(i % 4));
+    }
+    EXPECT_FALSE(list.hasValueIndex());
+    EXPECT_EQ(list.valueIndexMemoryUsage(), 0);
+    EXPECT_EQ(list.indexOf("v2"), 2);
+    EXPECT_EQ(list.count("v1"), 3);
+    EXPECT_EQ(list.indexOf("missing"), SinglyLinkedList::npos);
+    
+    list.enableValueIndex();
+    EXPECT_TRUE(list.hasValueIndex());
+    EXPECT_GT(list.valueIndexMemoryUsage(), 0);
+    EXPECT_TRUE(list.contains("v3"));
+    EXPECT_FALSE(list.contains("v4"));
+    EXPECT_EQ(list.count("v0"), 3);
+    EXPECT_EQ(list.indexOf("v3"), 3);
+    
+    list.push_front("v3");
+    EXPECT_EQ(list.indexOf("v3"), 0);
+    EXPECT_EQ(list.indexOf("v2"), 3);
+    list.pop_front();
+    list.pop_front();
+    EXPECT_EQ(list.indexOf("v0"), 3);
+    EXPECT_EQ(list.count("v0"), 2);
+    list.insert(1, "v0");
+    EXPECT_EQ(list.indexOf("v0"), 1);
+    list.remove(1);
+    list.remove(0);
+    EXPECT_EQ(list.indexOf("v1"), 3);
+    
+    SinglyLinkedList copy(list);
+    EXPECT_TRUE(copy.hasValueIndex());
+    EXPECT_EQ(copy.indexOf("v1"), 3);
+    
+    list.clear();
+    EXPECT_FALSE(list.contains("v1"));
+    EXPECT_TRUE(list.hasValueIndex());
+    list.disableValueIndex();
+    EXPECT_EQ(list.valueIndexMemoryUsage(), 0);
+}
+
+TEST(SinglyLinkedListTest, ValueIndexPopDuplicatedHead) {
+    SinglyLinkedList list;
+    list.enableValueIndex();
+    list.push_back("a");
+    list.push_back("b");
+    list.push_back("c");
+    list.push_back("a");
+    
+    list.pop_front();
+    EXPECT_TRUE(list.contains("a"));
+    EXPECT_EQ(list.count("a"), 1);
+    EXPECT_EQ(list.indexOf("a"), 2);
+    EXPECT_EQ(list.indexOf("b"), 0);
+    
+    // После пересчета позиции снова сдвигаются за O(1)
+    list.push_front("z");
+    EXPECT_EQ(list.indexOf("a"), 3);
+    list.pop_back();
+    EXPECT_FALSE(list.contains("a"));
+    EXPECT_EQ(list.indexOf("a"), SinglyLinkedList::npos);
+}
+
+TEST(SinglyLinkedListTest, ValueIndexSurvivesIteratorWrites) {
+    SinglyLinkedList list;
+    list.enableValueIndex();
+    list.push_back("a");
+    list.push_back("b");
+    
+    // Значение, которого нет в индексе, удаляется без обращения к end()
+    *list.begin() = "q";
+    list.pop_front();
+    EXPECT_EQ(list.toVector(), std::vector<std::string>({"b"}));
+    EXPECT_EQ(list.count("b"), 1);
+    EXPECT_FALSE(list.contains("a"));
+    EXPECT_FALSE(list.contains("q"));
+    EXPECT_EQ(list.indexOf("b"), 0);
+    
+    // Пересчет позиций тоже замечает незнакомые и пропавшие значения
+    list.push_back("c");
+    list.push_back("b");
+    list.push_back("d");
+    *list.begin() = "x";
+    list.remove(2);
+    EXPECT_EQ(list.indexOf("c"), 1);
+    EXPECT_EQ(list.indexOf("x"), 0);
+    EXPECT_EQ(list.indexOf("b"), SinglyLinkedList::npos);
+    EXPECT_EQ(list.count("x"), 1);
+    
+    *list.begin() = "c";
+    list.enableValueIndex();
+    EXPECT_EQ(list.count("c"), 2);
+    EXPECT_EQ(list.indexOf("d"), 2);
+    list.pop_front();
+    EXPECT_EQ(list.indexOf("c"), 0);
+}
+
+TEST(SinglyLinkedListTest, ValueIndexMatchesLinearScan) {
+    std::mt19937 gen(2024);
+    SinglyLinkedList indexed;
+    SinglyLinkedList plain;
+    indexed.enableValueIndex();
+    
+    for (int step = 0; step < 3000; step++) {
+        std::string value = "k" + std::to_string(gen() % 40);
+        int op = gen() % 7;
+        if (op == 0) {
+            indexed.push_front(value);
+            plain.push_front(value);
+        } else if (op <= 2) {
+            indexed.push_back(value);
+            plain.push_back(value);
+        } else if (op == 3 && !plain.empty()) {
+            indexed.pop_front();
+            plain.pop_front();
+        } else if (op == 4 && !plain.empty()) {
+            indexed.pop_back();
+            plain.pop_back();
+        } else if (op == 5) {
+            size_t index = gen() % (plain.size() + 1);
+            indexed.insert(index, value);
+            plain.insert(index, value);
+        } else if (op == 6 && !plain.empty()) {
+            size_t index = gen() % plain.size();
+            indexed.remove(index);
+            plain.remove(index);
+        }
+        
+        std::string probe = "k" + std::to_string(gen() % 42);
+        ASSERT_EQ(indexed.contains(probe), plain.contains(probe));
+        ASSERT_EQ(indexed.count(probe), plain.count(probe));
+        ASSERT_EQ(indexed.indexOf(probe), plain.indexOf(probe)) << "step " << step;
+    }
+    
+    std::stringstream ss;
+    plain.serialize(ss);
+    indexed.deserialize(ss);
+    EXPECT_EQ(indexed.indexOf("k7"), plain.indexOf("k7"));
+    EXPECT_EQ(indexed.count("k7"), plain.count("k7"));
+}
+
 // ==================== DOUBLY LINKED LIST TESTS ====================
 TEST_F(LinkedListTest, DoublyDefaultConstructor) {
     DoublyLinkedList list;
@@ -959,11 +2155,798 @@ TEST_F(LinkedListTest, DoublyComplexOperations) {
     EXPECT_GE(list.size(), 0);
 }
 
-// ==================== QUEUE TESTS ====================
-TEST_F(ContainerTest, QueueDefaultConstructor) {
-    Queue q;
-    EXPECT_TRUE(q.empty());
-    EXPECT_EQ(q.size(), 0);
+// ==================== UNROLLED LIST TESTS ====================
+TEST(UnrolledListTest, PushPopBothEnds) {
+    UnrolledList list;
+    EXPECT_TRUE(list.empty());
+    EXPECT_THROW(list.pop_front(), std::runtime_error);
+    EXPECT_THROW(list.pop_back(), std::runtime_error);
+    
+    for (int i = 0; i < 40; i++) {
+        list.push_back("b" + std::to_string(i));
+        list.push_front("f" + std::to_string(i));
+    }
+    EXPECT_EQ(list.size(), 80);
+    EXPECT_EQ(list.get(0), "f39");
+    EXPECT_EQ(list.get(39), "f0");
+    EXPECT_EQ(list.get(40), "b0");
+    EXPECT_EQ(list.get(79), "b39");
+    EXPECT_TRUE(list.checkIntegrity());
+    // Серии вставок с концов заполняют блоки целиком
+    EXPECT_LE(list.blockCount(), 80 / UnrolledList::BLOCK_CAPACITY + 2);
+    
+    list.pop_front();
+    list.pop_back();
+    EXPECT_EQ(list.get(0), "f38");
+    EXPECT_EQ(list.get(list.size() - 1), "b38");
+    EXPECT_THROW(list.get(78), std::out_of_range);
+    EXPECT_TRUE(list.checkIntegrity());
+}
+
+TEST(UnrolledListTest, InsertSplitsAndRemoveMergesBlocks) {
+    UnrolledList list;
+    for (size_t i = 0; i < UnrolledList::BLOCK_CAPACITY; i++) {
+        list.push_back(std::to_string(i));
+    }
+    EXPECT_EQ(list.blockCount(), 1);
+    
+    list.insert(3, "x");
+    EXPECT_EQ(list.blockCount(), 2);
+    EXPECT_EQ(list.get(3), "x");
+    EXPECT_EQ(list.get(4), "3");
+    EXPECT_TRUE(list.checkIntegrity());
+    EXPECT_THROW(list.insert(list.size() + 1, "y"), std::out_of_range);
+    
+    while (list.size() > 4) {
+        list.remove(1);
+    }
+    EXPECT_EQ(list.blockCount(), 1);
+    EXPECT_EQ(list.toVector(), std::vector<std::string>({"0", "13", "14", "15"}));
+    EXPECT_THROW(list.remove(4), std::out_of_range);
+    EXPECT_TRUE(list.checkIntegrity());
+}
+
+TEST(UnrolledListTest, MatchesDoublyLinkedListUnderRandomEdits) {
+    UnrolledList unrolled;
+    DoublyLinkedList reference;
+    std::mt19937 rng(15);
+    
+    for (int step = 0; step < 3000; step++) {
+        std::string value = "v" + std::to_string(step);
+        size_t op = rng() % 6;
+        if (op <= 2 || reference.empty()) {
+            size_t index = rng() % (reference.size() + 1);
+            unrolled.insert(index, value);
+            reference.insert(index, value);
+        } else if (op == 3) {
+            size_t index = rng() % reference.size();
+            unrolled.remove(index);
+            reference.remove(index);
+        } else if (op == 4) {
+            unrolled.pop_front();
+            reference.pop_front();
+        } else {
+            unrolled.pop_back();
+            reference.pop_back();
+        }
+        if (step % 100 == 0) {
+            ASSERT_TRUE(unrolled.checkIntegrity());
+            ASSERT_EQ(unrolled.toVector(), reference.toVector());
+        }
+    }
+    
+    EXPECT_EQ(unrolled.toVector(), reference.toVector());
+    for (size_t i = 0; i < reference.size(); i++) {
+        EXPECT_EQ(unrolled.get(i), reference.get(i));
+    }
+    EXPECT_TRUE(unrolled.contains(reference.get(reference.size() / 2)));
+    EXPECT_FALSE(unrolled.contains("missing"));
+}
+
+TEST(UnrolledListTest, SerializationCompatibleWithLinkedLists) {
+    SinglyLinkedList singly;
+    for (int i = 0; i < 50; i++) {
+        singly.push_back(i % 7 == 0 ? "line\n\"" + std::to_string(i) + "\"" : std::to_string(i));
+    }
+    
+    std::stringstream binary;
+    singly.serialize(binary);
+    UnrolledList unrolled;
+    unrolled.deserialize(binary);
+    EXPECT_EQ(unrolled.toVector(), singly.toVector());
+    EXPECT_TRUE(unrolled.checkIntegrity());
+    
+    std::stringstream fromSingly;
+    std::stringstream fromUnrolled;
+    singly.serialize(fromSingly);
+    unrolled.serialize(fromUnrolled);
+    EXPECT_EQ(fromUnrolled.str(), fromSingly.str());
+    
+    std::stringstream text;
+    unrolled.serializeText(text);
+    DoublyLinkedList doubly;
+    doubly.deserializeText(text);
+    EXPECT_EQ(doubly.toVector(), singly.toVector());
+    
+    UnrolledList copy(unrolled);
+    unrolled.clear();
+    EXPECT_TRUE(unrolled.empty());
+    EXPECT_EQ(unrolled.blockCount(), 0);
+    EXPECT_EQ(copy.toVector(), singly.toVector());
+}
+
+// ==================== LIST ITERATOR TESTS ====================
+TEST(ListIteratorTest, SinglyForwardIteratorWorksWithAlgorithms) {
+    SinglyLinkedList list;
+    for (int i = 0; i < 10; i++) {
+        list.push_back(std::to_string(i));
+    }
+    
+    EXPECT_EQ(std::distance(list.begin(), list.end()), 10);
+    EXPECT_EQ(std::vector<std::string>(list.cbegin(), list.cend()), list.toVector());
+    auto found = std::find(list.begin(), list.end(), "7");
+    ASSERT_TRUE(found != list.end());
+    EXPECT_EQ(found->size(), 1);
+    
+    for (std::string& value : list) {
+        value += "!";
+    }
+    EXPECT_EQ(list.get(9), "9!");
+    
+    const SinglyLinkedList& constList = list;
+    SinglyLinkedList::const_iterator it = list.begin();
+    EXPECT_TRUE(it == constList.begin());
+    EXPECT_EQ(*it++, "0!");
+    EXPECT_EQ(*it, "1!");
+    
+    SinglyLinkedList empty;
+    EXPECT_TRUE(empty.begin() == empty.end());
+}
+
+TEST(ListIteratorTest, DoublyIteratorIsBidirectional) {
+    DoublyLinkedList list;
+    for (int i = 0; i < 5; i++) {
+        list.push_back(std::to_string(i));
+    }
+    
+    std::vector<std::string> reversed(std::make_reverse_iterator(list.end()),
+                                      std::make_reverse_iterator(list.begin()));
+    EXPECT_EQ(reversed, std::vector<std::string>({"4", "3", "2", "1", "0"}));
+    
+    DoublyLinkedList::iterator last = std::prev(list.end());
+    EXPECT_EQ(*last, "4");
+    *last = "four";
+    EXPECT_EQ(list.get(4), "four");
+    EXPECT_EQ(*--last, "3");
+    EXPECT_EQ(*last--, "3");
+    EXPECT_EQ(*last, "2");
+}
+
+TEST(ListIteratorTest, ForEachVisitsInOrder) {
+    SinglyLinkedList singly;
+    DoublyLinkedList doubly;
+    for (int i = 0; i < 4; i++) {
+        singly.push_back(std::to_string(i));
+        doubly.push_front(std::to_string(i));
+    }
+    
+    std::string singlyOrder;
+    singly.forEach([&](const std::string& value) { singlyOrder += value; });
+    std::string doublyOrder;
+    doubly.forEach([&](const std::string& value) { doublyOrder += value; });
+    EXPECT_EQ(singlyOrder, "0123");
+    EXPECT_EQ(doublyOrder, "3210");
+}
+
+TEST(ListIteratorTest, CursorStaysConsistentUnderEdits) {
+    SinglyLinkedList singly;
+    DoublyLinkedList doubly;
+    std::vector<std::string> reference;
+    std::mt19937 rng(16);
+    
+    for (int step = 0; step < 4000; step++) {
+        std::string value = std::to_string(step);
+        size_t op = rng() % 7;
+        if (op <= 1 || reference.empty()) {
+            size_t index = rng() % (reference.size() + 1);
+            singly.insert(index, value);
+            doubly.insert(index, value);
+            reference.insert(reference.begin() + index, value);
+        } else if (op == 2) {
+            size_t index = rng() % reference.size();
+            singly.remove(index);
+            doubly.remove(index);
+            reference.erase(reference.begin() + index);
+        } else if (op == 3) {
+            singly.push_front(value);
+            doubly.push_front(value);
+            reference.insert(reference.begin(), value);
+        } else if (op == 4) {
+            singly.pop_front();
+            doubly.pop_front();
+            reference.erase(reference.begin());
+        } else if (op == 5) {
+            singly.pop_back();
+            doubly.pop_back();
+            reference.pop_back();
+        } else {
+            size_t index = rng() % reference.size();
+            ASSERT_EQ(singly.get(index), reference[index]);
+            ASSERT_EQ(doubly.get(index), reference[index]);
+        }
+    }
+    
+    for (size_t i = 0; i < reference.size(); i++) {
+        EXPECT_EQ(singly.get(i), reference[i]);
+        EXPECT_EQ(doubly.get(reference.size() - 1 - i), reference[reference.size() - 1 - i]);
+    }
+    EXPECT_TRUE(singly.checkIntegrity());
+    EXPECT_TRUE(doubly.checkIntegrity());
+}
+
+TEST(ListIteratorTest, SequentialGetIsLinearOverall) {
+    // Без курсора такой цикл по 200000 элементам занял бы минуты
+    const size_t count = 200000;
+    SinglyLinkedList singly;
+    DoublyLinkedList doubly;
+    for (size_t i = 0; i < count; i++) {
+        singly.push_back(std::to_string(i));
+        doubly.push_back(std::to_string(i));
+    }
+    
+    size_t mismatches = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (singly.get(i) != std::to_string(i) || doubly.get(i) != std::to_string(i)) {
+            mismatches++;
+        }
+    }
+    EXPECT_EQ(mismatches, 0);
+}
+
+// ==================== INDEXED LIST TESTS ====================
+TEST(IndexedListTest, PositionalOperations) {
+    IndexedList list;
+    EXPECT_TRUE(list.empty());
+    EXPECT_THROW(list.get(0), std::out_of_range);
+    EXPECT_THROW(list.pop_back(), std::runtime_error);
+    
+    for (int i = 0; i < 100; i++) {
+        list.push_back(std::to_string(i));
+    }
+    list.insert(50, "mid");
+    list.push_front("front");
+    EXPECT_EQ(list.size(), 102);
+    EXPECT_EQ(list.get(0), "front");
+    EXPECT_EQ(list.get(51), "mid");
+    EXPECT_EQ(list.get(52), "50");
+    EXPECT_EQ(list.get(101), "99");
+    
+    list.set(51, "MID");
+    EXPECT_EQ(list.get(51), "MID");
+    list.remove(51);
+    list.pop_front();
+    list.pop_back();
+    EXPECT_EQ(list.size(), 99);
+    EXPECT_EQ(list.get(50), "50");
+    EXPECT_EQ(list.get(98), "98");
+    EXPECT_THROW(list.insert(100, "x"), std::out_of_range);
+    EXPECT_THROW(list.remove(99), std::out_of_range);
+    EXPECT_THROW(list.set(99, "x"), std::out_of_range);
+    EXPECT_TRUE(list.checkIntegrity());
+    EXPECT_GT(list.levels(), 1);
+}
+
+TEST(IndexedListTest, MatchesDoublyLinkedListUnderRandomEdits) {
+    IndexedList indexed;
+    DoublyLinkedList reference;
+    std::mt19937 rng(17);
+    
+    for (int step = 0; step < 5000; step++) {
+        std::string value = std::to_string(step);
+        size_t op = rng() % 8;
+        if (op <= 2 || reference.empty()) {
+            size_t index = rng() % (reference.size() + 1);
+            indexed.insert(index, value);
+            reference.insert(index, value);
+        } else if (op == 3) {
+            size_t index = rng() % reference.size();
+            indexed.remove(index);
+            reference.remove(index);
+        } else if (op == 4) {
+            indexed.push_front(value);
+            reference.push_front(value);
+        } else if (op == 5) {
+            indexed.pop_front();
+            reference.pop_front();
+        } else if (op == 6) {
+            indexed.pop_back();
+            reference.pop_back();
+        } else {
+            size_t index = rng() % reference.size();
+            ASSERT_EQ(indexed.get(index), reference.get(index));
+        }
+        if (step % 250 == 0) {
+            ASSERT_TRUE(indexed.checkIntegrity());
+            ASSERT_EQ(indexed.toVector(), reference.toVector());
+        }
+    }
+    
+    EXPECT_TRUE(indexed.checkIntegrity());
+    EXPECT_EQ(indexed.toVector(), reference.toVector());
+    
+    while (!indexed.empty()) {
+        indexed.pop_back();
+    }
+    EXPECT_TRUE(indexed.checkIntegrity());
+    EXPECT_EQ(indexed.levels(), 1);
+}
+
+TEST(IndexedListTest, IteratorsAndSerialization) {
+    IndexedList list;
+    for (int i = 0; i < 20; i++) {
+        list.push_back(i == 3 ? "line\n\"3\"" : std::to_string(i));
+    }
+    
+    EXPECT_EQ(std::vector<std::string>(list.begin(), list.end()), list.toVector());
+    EXPECT_EQ(*std::prev(list.end()), "19");
+    EXPECT_TRUE(list.contains("line\n\"3\""));
+    EXPECT_FALSE(list.contains("20"));
+    
+    DoublyLinkedList doubly;
+    list.forEach([&](const std::string& value) { doubly.push_back(value); });
+    std::stringstream fromIndexed;
+    std::stringstream fromDoubly;
+    list.serialize(fromIndexed);
+    doubly.serialize(fromDoubly);
+    EXPECT_EQ(fromIndexed.str(), fromDoubly.str());
+    
+    IndexedList restored;
+    restored.deserialize(fromDoubly);
+    EXPECT_EQ(restored.toVector(), list.toVector());
+    EXPECT_TRUE(restored.checkIntegrity());
+    
+    std::stringstream text;
+    list.serializeText(text);
+    IndexedList fromText;
+    fromText.deserializeText(text);
+    EXPECT_EQ(fromText.toVector(), list.toVector());
+    
+    IndexedList copy(list);
+    list.clear();
+    EXPECT_TRUE(list.checkIntegrity());
+    EXPECT_EQ(copy.size(), 20);
+    EXPECT_TRUE(copy.checkIntegrity());
+}
+
+// ==================== COMPACT LIST TESTS ====================
+TEST(CompactListTest, BasicOperationsAndSlotReuse) {
+    CompactList list;
+    EXPECT_TRUE(list.empty());
+    EXPECT_TRUE(list.checkIntegrity());
+    EXPECT_THROW(list.pop_front(), std::runtime_error);
+    EXPECT_THROW(list.pop_back(), std::runtime_error);
+    EXPECT_THROW(list.get(0), std::out_of_range);
+    EXPECT_THROW(list.insert(1, "x"), std::out_of_range);
+    
+    list.push_back("b");
+    list.push_front("a");
+    list.push_back("d");
+    list.insert(2, "c");
+    list.set(3, "D");
+    EXPECT_EQ(list.toVector(), std::vector<std::string>({"a", "b", "c", "D"}));
+    EXPECT_TRUE(list.contains("c"));
+    EXPECT_FALSE(list.contains("d"));
+    EXPECT_TRUE(list.checkIntegrity());
+    
+    // Освобожденные слоты переиспользуются, массивы не растут
+    size_t slots = list.capacity();
+    list.remove(1);
+    list.pop_back();
+    list.push_back("e");
+    list.insert(1, "f");
+    EXPECT_EQ(list.capacity(), slots);
+    EXPECT_EQ(list.toVector(), std::vector<std::string>({"a", "f", "c", "e"}));
+    EXPECT_TRUE(list.checkIntegrity());
+    
+    list.pop_front();
+    EXPECT_EQ(list.get(0), "f");
+    EXPECT_EQ(list.capacity(), 4);
+    list.compact();
+    EXPECT_EQ(list.capacity(), 3);
+    EXPECT_EQ(list.toVector(), std::vector<std::string>({"f", "c", "e"}));
+    EXPECT_TRUE(list.checkIntegrity());
+    
+    std::string joined;
+    list.forEach([&](const std::string& value) { joined += value; });
+    EXPECT_EQ(joined, "fce");
+    
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.capacity(), 0);
+    EXPECT_TRUE(list.checkIntegrity());
+}
+
+TEST(CompactListTest, MatchesDoublyLinkedList) {
+    std::mt19937 gen(24);
+    CompactList compact;
+    DoublyLinkedList reference;
+    
+    for (int step = 0; step < 2000; step++) {
+        std::string value = "v" + std::to_string(step);
+        int op = gen() % 6;
+        if (op == 0) {
+            compact.push_front(value);
+            reference.push_front(value);
+        } else if (op == 1) {
+            compact.push_back(value);
+            reference.push_back(value);
+        } else if (op == 2) {
+            size_t index = gen() % (reference.size() + 1);
+            compact.insert(index, value);
+            reference.insert(index, value);
+        } else if (op == 3 && !reference.empty()) {
+            size_t index = gen() % reference.size();
+            compact.remove(index);
+            reference.remove(index);
+        } else if (op == 4 && !reference.empty()) {
+            compact.pop_front();
+            reference.pop_front();
+        } else if (op == 5 && !reference.empty()) {
+            size_t index = gen() % reference.size();
+            ASSERT_EQ(compact.get(index), reference.get(index));
+        }
+        if (step % 250 == 0) {
+            compact.compact();
+        }
+    }
+    
+    EXPECT_EQ(compact.toVector(), reference.toVector());
+    EXPECT_TRUE(compact.checkIntegrity());
+}
+
+TEST(CompactListTest, SerializationCompatibleWithLists) {
+    DoublyLinkedList doubly;
+    doubly.push_back("first");
+    doubly.push_back("");
+    doubly.push_back("line\nbreak");
+    doubly.push_back(std::string(100000, 'x'));
+    
+    std::stringstream fromDoubly;
+    doubly.serialize(fromDoubly);
+    CompactList list;
+    list.push_back("stale");
+    list.deserialize(fromDoubly);
+    EXPECT_EQ(list.toVector(), doubly.toVector());
+    EXPECT_TRUE(list.checkIntegrity());
+    
+    list.remove(1);
+    list.push_front("new");
+    std::stringstream fromCompact;
+    list.serialize(fromCompact);
+    SinglyLinkedList singly;
+    singly.deserialize(fromCompact);
+    EXPECT_EQ(singly.toVector(), list.toVector());
+    
+    std::stringstream text;
+    list.serializeText(text);
+    CompactList restored;
+    restored.deserializeText(text);
+    EXPECT_EQ(restored.toVector(), list.toVector());
+}
+
+TEST(CompactListTest, CorruptStreamLeavesListIntact) {
+    CompactList source;
+    source.push_back("alpha");
+    source.push_back("beta");
+    std::stringstream full;
+    source.serialize(full);
+    std::string bytes = full.str();
+    
+    CompactList list;
+    list.push_back("keep");
+    
+    // Обрезанный поток
+    std::stringstream truncated(bytes.substr(0, bytes.size() - 2));
+    EXPECT_THROW(list.deserialize(truncated), std::runtime_error);
+    
+    // Огромная длина строки
+    std::string hugeLength = bytes;
+    size_t bad = SIZE_MAX / 2;
+    hugeLength.replace(sizeof(size_t), sizeof(size_t), reinterpret_cast<const char*>(&bad), sizeof(bad));
+    std::stringstream corrupt(hugeLength);
+    EXPECT_THROW(list.deserialize(corrupt), std::runtime_error);
+    
+    // Огромный счетчик не должен резервировать память под себя
+    std::string hugeCount = bytes;
+    size_t count = CompactList::NIL;
+    hugeCount.replace(0, sizeof(size_t), reinterpret_cast<const char*>(&count), sizeof(count));
+    std::stringstream overstated(hugeCount);
+    EXPECT_THROW(list.deserialize(overstated), std::runtime_error);
+    
+    EXPECT_EQ(list.toVector(), std::vector<std::string>({"keep"}));
+    list.push_back("a");
+    list.push_back("b");
+    EXPECT_TRUE(list.checkIntegrity());
+    
+    std::stringstream again(bytes);
+    list.deserialize(again);
+    EXPECT_EQ(list.toVector(), source.toVector());
+    EXPECT_TRUE(list.checkIntegrity());
+}
+
+// ==================== LIST SPLICE AND SORT TESTS ====================
+namespace {
+    DoublyLinkedList makeDoubly(const std::vector<std::string>& values) {
+        DoublyLinkedList list;
+        for (const auto& value : values) {
+            list.push_back(value);
+        }
+        return list;
+    }
+}
+
+TEST(ListSpliceTest, SpliceConcatAndSplit) {
+    DoublyLinkedList list = makeDoubly({"a", "b", "c"});
+    DoublyLinkedList middle = makeDoubly({"x", "y"});
+    
+    list.splice(1, middle);
+    EXPECT_EQ(list.toVector(), std::vector<std::string>({"a", "x", "y", "b", "c"}));
+    EXPECT_TRUE(middle.empty());
+    EXPECT_TRUE(middle.checkIntegrity());
+    
+    DoublyLinkedList front = makeDoubly({"0"});
+    list.splice(0, front);
+    DoublyLinkedList back = makeDoubly({"z"});
+    list.concat(back);
+    EXPECT_EQ(list.toVector(), std::vector<std::string>({"0", "a", "x", "y", "b", "c", "z"}));
+    EXPECT_TRUE(list.checkIntegrity());
+    
+    DoublyLinkedList rest = list.splitAt(3);
+    EXPECT_EQ(list.toVector(), std::vector<std::string>({"0", "a", "x"}));
+    EXPECT_EQ(rest.toVector(), std::vector<std::string>({"y", "b", "c", "z"}));
+    EXPECT_EQ(*std::prev(rest.end()), "z");
+    EXPECT_TRUE(list.checkIntegrity());
+    EXPECT_TRUE(rest.checkIntegrity());
+    
+    DoublyLinkedList all = list.splitAt(0);
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(all.size(), 3);
+    EXPECT_TRUE(list.splitAt(0).empty());
+    
+    EXPECT_THROW(all.splice(4, rest), std::out_of_range);
+    EXPECT_THROW(all.splitAt(4), std::out_of_range);
+    EXPECT_THROW(all.splice(0, all), std::invalid_argument);
+    
+    DoublyLinkedList empty;
+    all.concat(empty);
+    empty.concat(all);
+    EXPECT_TRUE(all.empty());
+    EXPECT_EQ(empty.toVector(), std::vector<std::string>({"0", "a", "x"}));
+}
+
+TEST(ListSpliceTest, SplitPartsOutliveEachOther) {
+    DoublyLinkedList tail = [] {
+        DoublyLinkedList list;
+        for (int i = 0; i < 100; i++) {
+            list.push_back(std::to_string(i));
+        }
+        DoublyLinkedList rest = list.splitAt(50);
+        list.push_back("more");
+        list.remove(10);
+        return rest;
+    }();
+    EXPECT_EQ(tail.size(), 50);
+    EXPECT_EQ(tail.get(0), "50");
+    tail.push_front("front");
+    tail.pop_back();
+    EXPECT_EQ(tail.get(49), "98");
+    EXPECT_TRUE(tail.checkIntegrity());
+}
+
+TEST(ListSpliceTest, SpliceBetweenSharedPoolsMovesNodes) {
+    DoublyLinkedList first = makeDoubly({"1", "2", "3", "4"});
+    DoublyLinkedList second = makeDoubly({"a", "b", "c", "d"});
+    DoublyLinkedList firstTail = first.splitAt(2);
+    DoublyLinkedList secondTail = second.splitAt(2);
+    
+    // Оба пула общие, но узлы все равно переносятся, а не копируются
+    const std::string* movedFirst = &*second.begin();
+    const std::string* movedTail = &*secondTail.begin();
+    first.concat(second);
+    second.push_back("new");
+    firstTail.concat(secondTail);
+    EXPECT_EQ(&*std::next(first.begin(), 2), movedFirst);
+    EXPECT_EQ(&*std::next(firstTail.begin(), 2), movedTail);
+    EXPECT_EQ(first.toVector(), std::vector<std::string>({"1", "2", "a", "b"}));
+    EXPECT_EQ(second.toVector(), std::vector<std::string>({"new"}));
+    EXPECT_EQ(firstTail.toVector(), std::vector<std::string>({"3", "4", "c", "d"}));
+    EXPECT_TRUE(secondTail.empty());
+    
+    first.clear();
+    secondTail.concat(firstTail);
+    EXPECT_EQ(secondTail.toVector(), std::vector<std::string>({"3", "4", "c", "d"}));
+    EXPECT_TRUE(secondTail.checkIntegrity());
+    
+    // Списки, которые еще ссылаются на слитый пул, продолжают работать
+    second.push_front("front");
+    second.pop_back();
+    EXPECT_EQ(second.toVector(), std::vector<std::string>({"front"}));
+    secondTail.clear();
+    EXPECT_EQ(second.get(0), "front");
+}
+
+TEST(ListSpliceTest, MovedFromListGetsOwnPool) {
+    DoublyLinkedList source = makeDoubly({"a", "b"});
+    DoublyLinkedList target(std::move(source));
+    source.push_back("again");
+    target.concat(source);
+    EXPECT_EQ(target.toVector(), std::vector<std::string>({"a", "b", "again"}));
+    EXPECT_TRUE(source.empty());
+    source.push_back("x");
+    target.clear();
+    EXPECT_EQ(source.toVector(), std::vector<std::string>({"x"}));
+    
+    DoublyLinkedList parts = makeDoubly({"1", "2", "3", "4"});
+    DoublyLinkedList rest = parts.splitAt(2);
+    DoublyLinkedList other = makeDoubly({"5", "6"});
+    DoublyLinkedList otherRest = other.splitAt(1);
+    parts.concat(otherRest);
+    rest.concat(other);
+    EXPECT_EQ(parts.toVector(), std::vector<std::string>({"1", "2", "6"}));
+    EXPECT_EQ(rest.toVector(), std::vector<std::string>({"3", "4", "5"}));
+    EXPECT_TRUE(parts.checkIntegrity());
+    EXPECT_TRUE(rest.checkIntegrity());
+}
+
+TEST(ListSortTest, MergeSortIsStable) {
+    std::mt19937 rng(18);
+    std::vector<std::string> values;
+    DoublyLinkedList list;
+    for (int i = 0; i < 1000; i++) {
+        std::string value = std::to_string(rng() % 100) + ":" + std::to_string(i);
+        values.push_back(value);
+        list.push_back(value);
+    }
+    
+    // Сравниваем только ключ до ':' - порядок равных должен сохраниться
+    auto byKey = [](const std::string& a, const std::string& b) {
+        return a.substr(0, a.find(':')) < b.substr(0, b.find(':'));
+    };
+    std::stable_sort(values.begin(), values.end(), byKey);
+    list.sort(byKey);
+    EXPECT_EQ(list.toVector(), values);
+    EXPECT_TRUE(list.checkIntegrity());
+    
+    std::sort(values.begin(), values.end());
+    list.sort();
+    EXPECT_EQ(list.toVector(), values);
+    EXPECT_EQ(list.get(999), values[999]);
+    EXPECT_EQ(*std::prev(list.end()), values.back());
+    EXPECT_TRUE(list.checkIntegrity());
+    
+    DoublyLinkedList single = makeDoubly({"only"});
+    single.sort();
+    EXPECT_EQ(single.get(0), "only");
+    DoublyLinkedList empty;
+    empty.sort();
+    EXPECT_TRUE(empty.checkIntegrity());
+}
+
+// ==================== INTRUSIVE LIST TESTS ====================
+namespace {
+    struct ReadyTag {};
+    
+    struct Job : SListHook<>, ListHook<>, ListHook<ReadyTag> {
+        int id;
+        explicit Job(int value) : id(value) {}
+    };
+}
+
+TEST(IntrusiveListTest, SinglyLinksCallerObjects) {
+    std::vector<Job> jobs;
+    for (int i = 0; i < 5; i++) {
+        jobs.emplace_back(i);
+    }
+    
+    IntrusiveSinglyList<Job> list;
+    EXPECT_THROW(list.pop_front(), std::runtime_error);
+    list.push_back(jobs[1]);
+    list.push_back(jobs[2]);
+    list.push_front(jobs[0]);
+    list.insertAfter(jobs[2], jobs[4]);
+    list.insertAfter(jobs[2], jobs[3]);
+    EXPECT_EQ(list.size(), 5);
+    EXPECT_EQ(&list.back(), &jobs[4]);
+    EXPECT_TRUE(jobs[3].SListHook<>::isLinked());
+    EXPECT_THROW(list.push_back(jobs[3]), std::invalid_argument);
+    
+    int expected = 0;
+    for (const Job& job : list) {
+        EXPECT_EQ(job.id, expected++);
+    }
+    
+    EXPECT_TRUE(list.remove(jobs[4]));
+    EXPECT_EQ(&list.back(), &jobs[3]);
+    EXPECT_FALSE(list.remove(jobs[4]));
+    EXPECT_EQ(list.eraseAfter(jobs[1]).id, 2);
+    EXPECT_THROW(list.eraseAfter(jobs[3]), std::out_of_range);
+    EXPECT_EQ(list.pop_front().id, 0);
+    EXPECT_FALSE(jobs[0].SListHook<>::isLinked());
+    EXPECT_EQ(list.size(), 2);
+    
+    // Копия объекта не наследует связи оригинала
+    Job copy = jobs[1];
+    EXPECT_FALSE(copy.SListHook<>::isLinked());
+    
+    list.clear();
+    EXPECT_TRUE(list.empty());
+    EXPECT_FALSE(jobs[1].SListHook<>::isLinked());
+}
+
+TEST(IntrusiveListTest, DoublyUnlinksByReference) {
+    std::vector<Job> jobs;
+    for (int i = 0; i < 6; i++) {
+        jobs.emplace_back(i);
+    }
+    
+    IntrusiveDoublyList<Job> all;
+    IntrusiveDoublyList<Job, ReadyTag> ready;
+    for (auto& job : jobs) {
+        all.push_back(job);
+        if (job.id % 2 == 0) {
+            ready.push_front(job);
+        }
+    }
+    EXPECT_EQ(all.size(), 6);
+    EXPECT_EQ(ready.size(), 3);
+    EXPECT_EQ(ready.front().id, 4);
+    
+    // Объект состоит в двух списках; удаление из одного не трогает другой
+    all.erase(jobs[4]);
+    EXPECT_FALSE(jobs[4].ListHook<>::isLinked());
+    EXPECT_TRUE(jobs[4].ListHook<ReadyTag>::isLinked());
+    EXPECT_THROW(all.erase(jobs[4]), std::invalid_argument);
+    EXPECT_EQ(ready.pop_front().id, 4);
+    
+    std::vector<int> ids;
+    for (auto it = all.end(); it != all.begin();) {
+        --it;
+        ids.push_back(it->id);
+    }
+    EXPECT_EQ(ids, std::vector<int>({5, 3, 2, 1, 0}));
+    
+    auto it = all.insert(all.iteratorTo(jobs[2]), jobs[4]);
+    EXPECT_EQ(it->id, 4);
+    it = all.erase(all.iteratorTo(jobs[1]));
+    EXPECT_EQ(it->id, 4);
+    EXPECT_EQ(all.pop_back().id, 5);
+    
+    IntrusiveDoublyList<Job> tail;
+    tail.push_back(jobs[5]);
+    tail.push_back(jobs[1]);
+    all.splice(tail);
+    EXPECT_TRUE(tail.empty());
+    EXPECT_THROW(all.splice(all), std::invalid_argument);
+    ids.clear();
+    for (const Job& job : all) {
+        ids.push_back(job.id);
+    }
+    EXPECT_EQ(ids, std::vector<int>({0, 4, 2, 3, 5, 1}));
+    EXPECT_EQ(&all.back(), &jobs[1]);
+    
+    all.clear();
+    ready.clear();
+    for (const auto& job : jobs) {
+        EXPECT_FALSE(job.ListHook<>::isLinked());
+        EXPECT_FALSE(job.ListHook<ReadyTag>::isLinked());
+    }
+}
+
+// ==================== QUEUE TESTS ====================
+TEST_F(ContainerTest, QueueDefaultConstructor) {
+    Queue q;
+    EXPECT_TRUE(q.empty());
+    EXPECT_EQ(q.size(), 0);
 }
 
 TEST_F(ContainerTest, QueueEnqueueDequeue) {
@@ -1018,6 +3001,399 @@ TEST_F(ContainerTest, QueueSerialization) {
     }
 }
 
+TEST_F(ContainerTest, QueueRingBufferWrapAndGrowth) {
+    Queue q;
+    // Голова уходит вперед, хвост переходит через конец буфера
+    int pushed = 0;
+    int popped = 0;
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 6; ++i) {
+            q.enqueue(to_string(pushed++));
+        }
+        for (int i = 0; i < 5; ++i) {
+            ASSERT_EQ(q.dequeue(), to_string(popped++));
+        }
+    }
+    EXPECT_EQ(q.size(), 3);
+    EXPECT_EQ(q.getCapacity(), 8);
+    
+    // Рост при перевернутом буфере сохраняет порядок
+    for (int i = 0; i < 20; ++i) {
+        q.enqueue("grow" + to_string(i));
+    }
+    EXPECT_EQ(q.getCapacity(), 32);
+    EXPECT_EQ(q.front(), "15");
+    EXPECT_EQ(q.back(), "grow19");
+    for (int i = 0; i < 3; ++i) {
+        q.dequeue();
+    }
+    EXPECT_EQ(q.dequeue(), "grow0");
+    
+    Queue copy(q);
+    Queue moved(std::move(q));
+    EXPECT_TRUE(q.empty());
+    EXPECT_EQ(copy.size(), 19);
+    EXPECT_EQ(moved.front(), "grow1");
+    EXPECT_EQ(copy.back(), "grow19");
+}
+
+TEST_F(ContainerTest, QueueBatchOperations) {
+    Queue q;
+    q.enqueue("first");
+    vector<string> values = {"a", "b", "c", "d"};
+    q.enqueueBatch(values.begin(), values.end());
+    EXPECT_EQ(q.size(), 5);
+    EXPECT_EQ(q.back(), "d");
+    
+    string out[3];
+    EXPECT_EQ(q.dequeueBatch(out, 3), 3);
+    EXPECT_EQ(out[0], "first");
+    EXPECT_EQ(out[2], "b");
+    
+    vector<string> rest;
+    EXPECT_EQ(q.dequeueBatch(back_inserter(rest), 10), 2);
+    EXPECT_EQ(rest, (vector<string>{"c", "d"}));
+    EXPECT_TRUE(q.empty());
+    EXPECT_EQ(q.dequeueBatch(out, 3), 0);
+    
+    // Формат совпадает с прежней очередью на списке
+    SinglyLinkedList list;
+    for (const char* value : {"x", "y\nz", "\"w\""}) {
+        list.push_back(value);
+        q.enqueue(value);
+    }
+    stringstream listBinary;
+    stringstream queueBinary;
+    list.serialize(listBinary);
+    q.serialize(queueBinary);
+    EXPECT_EQ(queueBinary.str(), listBinary.str());
+    
+    stringstream text;
+    q.serializeText(text);
+    Queue fromText;
+    fromText.deserializeText(text);
+    EXPECT_EQ(fromText.dequeue(), "x");
+    EXPECT_EQ(fromText.dequeue(), "y\nz");
+}
+
+// ==================== MPMC QUEUE TESTS ====================
+TEST(MPMCQueueTest, SingleThreadFifoAndBounds) {
+    MPMCQueue queue(5);
+    EXPECT_EQ(queue.capacity(), 8);
+    EXPECT_TRUE(queue.empty());
+    
+    std::string out;
+    EXPECT_FALSE(queue.try_dequeue(out));
+    for (int i = 0; i < 8; i++) {
+        EXPECT_TRUE(queue.try_enqueue(std::to_string(i)));
+    }
+    std::string rejected = "rejected";
+    EXPECT_FALSE(queue.try_enqueue(std::move(rejected)));
+    EXPECT_EQ(rejected, "rejected");
+    EXPECT_EQ(queue.size(), 8);
+    
+    // Несколько кругов по буферу
+    for (int i = 8; i < 30; i++) {
+        ASSERT_TRUE(queue.try_dequeue(out));
+        EXPECT_EQ(out, std::to_string(i - 8));
+        ASSERT_TRUE(queue.try_enqueue(std::to_string(i)));
+    }
+    
+    std::vector<std::string> drained;
+    EXPECT_EQ(queue.try_dequeue_batch(std::back_inserter(drained), 100), 8);
+    EXPECT_EQ(drained.front(), "22");
+    EXPECT_EQ(drained.back(), "29");
+    EXPECT_TRUE(queue.empty());
+    
+    std::vector<std::string> batch = {"a", "b", "c", "d", "e", "f", "g", "h", "i", "j"};
+    EXPECT_EQ(queue.try_enqueue_batch(batch.begin(), batch.end()), 8);
+    EXPECT_EQ(batch[9], "j");
+    EXPECT_TRUE(queue.try_dequeue(out));
+    EXPECT_EQ(out, "a");
+}
+
+TEST(MPMCQueueTest, ConcurrentProducersAndConsumers) {
+    const int producers = 4;
+    const int consumers = 4;
+    const int perProducer = 5000;
+    MPMCQueue queue(64);
+    std::atomic<long long> consumedSum(0);
+    std::atomic<int> consumedCount(0);
+    std::vector<std::atomic<int>> seen(producers * perProducer);
+    for (auto& flag : seen) {
+        flag.store(0);
+    }
+    
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&, p]() {
+            for (int i = 0; i < perProducer; i++) {
+                std::string value = std::to_string(p * perProducer + i);
+                while (!queue.try_enqueue(value)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < consumers; c++) {
+        threads.emplace_back([&]() {
+            std::string value;
+            while (consumedCount.load() < producers * perProducer) {
+                if (queue.try_dequeue(value)) {
+                    int number = std::stoi(value);
+                    seen[number].fetch_add(1);
+                    consumedSum.fetch_add(number);
+                    consumedCount.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    long long total = static_cast<long long>(producers) * perProducer;
+    EXPECT_EQ(consumedSum.load(), total * (total - 1) / 2);
+    for (const auto& flag : seen) {
+        ASSERT_EQ(flag.load(), 1);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(MPMCQueueTest, SnapshotCompatibleWithQueue) {
+    Queue plain;
+    for (int i = 0; i < 6; i++) {
+        plain.enqueue(i == 2 ? std::string("line\nbreak") : std::to_string(i));
+    }
+    
+    std::stringstream fromPlain;
+    plain.serialize(fromPlain);
+    MPMCQueue queue(8);
+    queue.try_enqueue("stale");
+    queue.deserialize(fromPlain);
+    EXPECT_EQ(queue.size(), 6);
+    
+    std::stringstream fromConcurrent;
+    queue.serialize(fromConcurrent);
+    std::stringstream expected;
+    plain.serialize(expected);
+    EXPECT_EQ(fromConcurrent.str(), expected.str());
+    
+    Queue restored;
+    restored.deserialize(fromConcurrent);
+    EXPECT_EQ(restored.size(), 6);
+    EXPECT_EQ(restored.dequeue(), "0");
+    
+    std::string out;
+    queue.try_dequeue(out);
+    queue.try_dequeue(out);
+    EXPECT_EQ(queue.size(), 4);
+    std::stringstream partial;
+    queue.serialize(partial);
+    Queue partialQueue;
+    partialQueue.deserialize(partial);
+    EXPECT_EQ(partialQueue.front(), "line\nbreak");
+    
+    MPMCQueue small(2);
+    std::stringstream tooBig;
+    plain.serialize(tooBig);
+    EXPECT_THROW(small.deserialize(tooBig), std::runtime_error);
+}
+
+// ==================== BLOCKING QUEUE TESTS ====================
+TEST(BlockingQueueTest, TimedWaitsOnEmptyAndFull) {
+    BlockingQueue queue(2);
+    EXPECT_EQ(queue.capacity(), 2);
+    
+    std::string out;
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(queue.dequeueWait(out, std::chrono::milliseconds(20)));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+    
+    EXPECT_TRUE(queue.enqueueWait("a", std::chrono::milliseconds(0)));
+    EXPECT_TRUE(queue.enqueueWait("b", std::chrono::milliseconds(0)));
+    std::string rejected = "c";
+    EXPECT_FALSE(queue.enqueueWait(std::move(rejected), std::chrono::milliseconds(10)));
+    EXPECT_EQ(rejected, "c");
+    EXPECT_EQ(queue.size(), 2);
+    
+    EXPECT_TRUE(queue.dequeueWait(out, std::chrono::milliseconds(0)));
+    EXPECT_EQ(out, "a");
+    EXPECT_TRUE(queue.enqueueWait("c", std::chrono::milliseconds(0)));
+    
+    std::vector<std::string> batch = {"d", "e"};
+    EXPECT_EQ(queue.enqueueBatchWait(batch.begin(), batch.end(), std::chrono::milliseconds(0)), 0);
+    
+    std::vector<std::string> drained;
+    EXPECT_EQ(queue.dequeueBatchWait(std::back_inserter(drained), 10, std::chrono::milliseconds(0)), 2);
+    EXPECT_EQ(drained, std::vector<std::string>({"b", "c"}));
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.dequeueBatchWait(std::back_inserter(drained), 0, std::chrono::milliseconds(0)), 0);
+}
+
+TEST(BlockingQueueTest, CapacityIsOnlyALimit) {
+    // Емкость не выделяется заранее: огромный предел ничего не стоит
+    BlockingQueue huge(SIZE_MAX);
+    EXPECT_EQ(huge.capacity(), SIZE_MAX);
+    EXPECT_TRUE(huge.enqueueWait("a", std::chrono::milliseconds(0)));
+    std::string out;
+    EXPECT_TRUE(huge.dequeueWait(out, std::chrono::milliseconds(0)));
+    EXPECT_EQ(out, "a");
+    
+    Queue queue;
+    EXPECT_THROW(queue.reserve(SIZE_MAX), std::length_error);
+    EXPECT_EQ(queue.getCapacity(), 0);
+}
+
+TEST(BlockingQueueTest, ProducersAndConsumersHandOff) {
+    const int producers = 3;
+    const int consumers = 3;
+    const int perProducer = 2000;
+    BlockingQueue queue(16);
+    std::atomic<long long> consumedSum(0);
+    std::atomic<int> consumedCount(0);
+    
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&, p]() {
+            std::vector<std::string> batch;
+            for (int i = 0; i < perProducer; i++) {
+                std::string value = std::to_string(p * perProducer + i);
+                if (i % 2 == 0) {
+                    ASSERT_TRUE(queue.enqueueWait(std::move(value), std::chrono::seconds(10)));
+                } else {
+                    batch.push_back(std::move(value));
+                }
+            }
+            // Пакет может не поместиться целиком - досылаем остаток
+            auto first = batch.begin();
+            while (first != batch.end()) {
+                first += queue.enqueueBatchWait(first, batch.end(), std::chrono::seconds(10));
+            }
+        });
+    }
+    for (int c = 0; c < consumers; c++) {
+        threads.emplace_back([&, c]() {
+            std::vector<std::string> values;
+            std::string value;
+            while (true) {
+                values.clear();
+                if (c == 0) {
+                    queue.dequeueBatchWait(std::back_inserter(values), 8, std::chrono::milliseconds(50));
+                } else if (queue.dequeueWait(value, std::chrono::milliseconds(50))) {
+                    values.push_back(value);
+                }
+                if (values.empty() && queue.isClosed()) {
+                    break;
+                }
+                for (const auto& item : values) {
+                    consumedSum.fetch_add(std::stoi(item));
+                    consumedCount.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (int p = 0; p < producers; p++) {
+        threads[p].join();
+    }
+    queue.close();
+    EXPECT_FALSE(queue.enqueueWait("late", std::chrono::milliseconds(0)));
+    for (size_t i = producers; i < threads.size(); i++) {
+        threads[i].join();
+    }
+    
+    long long total = static_cast<long long>(producers) * perProducer;
+    EXPECT_EQ(consumedCount.load(), total);
+    EXPECT_EQ(consumedSum.load(), total * (total - 1) / 2);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(BlockingQueueTest, BatchWakesOneConsumerPerItem) {
+    BlockingQueue queue;
+    const int consumers = 16;
+    std::atomic<int> received(0);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < consumers; i++) {
+        threads.emplace_back([&]() {
+            std::string out;
+            if (queue.dequeueWait(out, std::chrono::seconds(10))) {
+                received++;
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    
+    // Два элемента - два пробуждения, и оба элемента быстро разобраны
+    std::vector<std::string> batch = {"a", "b"};
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(queue.enqueueBatchWait(batch.begin(), batch.end(), std::chrono::milliseconds(0)), 2);
+    while (received.load() < 2 && std::chrono::steady_clock::now() - start < std::chrono::seconds(5)) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(received.load(), 2);
+    EXPECT_TRUE(queue.empty());
+    
+    queue.close();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(received.load(), 2);
+}
+
+TEST(BlockingQueueTest, CloseWakesWaitersAndDrains) {
+    BlockingQueue queue(1);
+    queue.enqueueWait("left", std::chrono::milliseconds(0));
+    
+    std::atomic<bool> producerResult(true);
+    std::thread producer([&]() {
+        producerResult = queue.enqueueWait("blocked", std::chrono::seconds(10));
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    auto start = std::chrono::steady_clock::now();
+    queue.close();
+    producer.join();
+    EXPECT_FALSE(producerResult.load());
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+    EXPECT_TRUE(queue.isClosed());
+    
+    // Остаток дочитывается, затем ожидание сразу возвращает false
+    std::string out;
+    EXPECT_TRUE(queue.dequeueWait(out, std::chrono::seconds(10)));
+    EXPECT_EQ(out, "left");
+    start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(queue.dequeueWait(out, std::chrono::seconds(10)));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
+
+TEST(BlockingQueueTest, SnapshotCompatibleWithQueue) {
+    Queue plain;
+    for (int i = 0; i < 5; i++) {
+        plain.enqueue(i == 1 ? std::string("line\nbreak") : std::to_string(i));
+    }
+    
+    std::stringstream fromPlain;
+    plain.serialize(fromPlain);
+    BlockingQueue queue(3);
+    queue.deserialize(fromPlain);
+    EXPECT_EQ(queue.size(), 5);
+    
+    std::stringstream fromBlocking;
+    queue.serialize(fromBlocking);
+    std::stringstream expected;
+    plain.serialize(expected);
+    EXPECT_EQ(fromBlocking.str(), expected.str());
+    
+    // Пока очередь переполнена снимком, вставка отклоняется
+    EXPECT_FALSE(queue.enqueueWait("extra", std::chrono::milliseconds(0)));
+    std::string out;
+    EXPECT_TRUE(queue.dequeueWait(out, std::chrono::milliseconds(0)));
+    EXPECT_EQ(out, "0");
+    EXPECT_TRUE(queue.dequeueWait(out, std::chrono::milliseconds(0)));
+    EXPECT_EQ(out, "line\nbreak");
+}
+
 // ==================== STACK TESTS ====================
 TEST_F(ContainerTest, StackDefaultConstructor) {
     Stack st;
@@ -1073,6 +3449,247 @@ TEST_F(ContainerTest, StackSerialization) {
     }
 }
 
+TEST_F(ContainerTest, StackMoveAndReserve) {
+    Stack st;
+    st.reserve(1000);
+    string value(100, 'x');
+    st.push(std::move(value));
+    for (int i = 0; i < 1000; ++i) {
+        st.push(to_string(i));
+    }
+    EXPECT_EQ(st.top(), "999");
+    EXPECT_EQ(st.size(), 1001);
+    
+    for (int i = 999; i >= 0; --i) {
+        ASSERT_EQ(st.pop(), to_string(i));
+    }
+    EXPECT_EQ(st.pop(), string(100, 'x'));
+    EXPECT_THROW(st.pop(), runtime_error);
+    EXPECT_THROW(st.top(), runtime_error);
+    
+    Array<string> arr;
+    arr.insert("last");
+    EXPECT_EQ(arr.popBack(), "last");
+    EXPECT_THROW(arr.popBack(), out_of_range);
+}
+
+TEST_F(ContainerTest, StackFormatMatchesLinkedList) {
+    // Прежний Stack хранил элементы в SinglyLinkedList от дна к вершине
+    SinglyLinkedList list;
+    Stack st;
+    for (const char* value : {"bottom", "middle\nline", "top \"quoted\""}) {
+        list.push_back(value);
+        st.push(value);
+    }
+    
+    stringstream listBinary;
+    stringstream stackBinary;
+    list.serialize(listBinary);
+    st.serialize(stackBinary);
+    EXPECT_EQ(stackBinary.str(), listBinary.str());
+    
+    stringstream listText;
+    stringstream stackText;
+    list.serializeText(listText);
+    st.serializeText(stackText);
+    EXPECT_EQ(stackText.str(), listText.str());
+    
+    Stack loaded;
+    loaded.deserialize(listBinary);
+    EXPECT_EQ(loaded.pop(), "top \"quoted\"");
+    EXPECT_EQ(loaded.pop(), "middle\nline");
+}
+
+// ==================== CONCURRENT STACK TESTS ====================
+TEST(ConcurrentStackTest, SingleThreadLifoAndReclamation) {
+    ConcurrentStack stack;
+    std::string out;
+    EXPECT_TRUE(stack.empty());
+    EXPECT_FALSE(stack.try_pop(out));
+    
+    stack.push("bottom");
+    std::string moved = "top";
+    stack.push(std::move(moved));
+    ASSERT_TRUE(stack.try_pop(out));
+    EXPECT_EQ(out, "top");
+    ASSERT_TRUE(stack.try_pop(out));
+    EXPECT_EQ(out, "bottom");
+    EXPECT_TRUE(stack.empty());
+    
+    // Снятые узлы освобождаются по ходу работы, а не копятся до деструктора
+    for (int i = 0; i < 10000; i++) {
+        stack.push(std::to_string(i));
+        ASSERT_TRUE(stack.try_pop(out));
+    }
+    EXPECT_LT(stack.pendingReclamation(), 1000);
+}
+
+TEST(ConcurrentStackTest, ConcurrentPushPopKeepsEveryValue) {
+    const int threadsPerRole = 4;
+    const int perThread = 5000;
+    ConcurrentStack stack;
+    std::atomic<int> popped(0);
+    std::atomic<long long> sum(0);
+    std::vector<std::atomic<int>> seen(threadsPerRole * perThread);
+    for (auto& flag : seen) {
+        flag.store(0);
+    }
+    
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadsPerRole; t++) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < perThread; i++) {
+                stack.push(std::to_string(t * perThread + i));
+            }
+        });
+        threads.emplace_back([&]() {
+            std::string value;
+            while (popped.load() < threadsPerRole * perThread) {
+                if (stack.try_pop(value)) {
+                    int number = std::stoi(value);
+                    seen[number].fetch_add(1);
+                    sum.fetch_add(number);
+                    popped.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    long long total = static_cast<long long>(threadsPerRole) * perThread;
+    EXPECT_EQ(sum.load(), total * (total - 1) / 2);
+    for (const auto& flag : seen) {
+        ASSERT_EQ(flag.load(), 1);
+    }
+    EXPECT_TRUE(stack.empty());
+}
+
+TEST(ConcurrentStackTest, SerializationCompatibleWithStack) {
+    Stack plain;
+    plain.push("first");
+    plain.push("second\nline");
+    plain.push("third");
+    
+    std::stringstream fromPlain;
+    plain.serialize(fromPlain);
+    ConcurrentStack stack;
+    stack.push("stale");
+    stack.deserialize(fromPlain);
+    
+    std::stringstream fromConcurrent;
+    stack.serialize(fromConcurrent);
+    std::stringstream expected;
+    plain.serialize(expected);
+    EXPECT_EQ(fromConcurrent.str(), expected.str());
+    
+    std::string out;
+    ASSERT_TRUE(stack.try_pop(out));
+    EXPECT_EQ(out, "third");
+    
+    Stack restored;
+    restored.deserialize(fromConcurrent);
+    EXPECT_EQ(restored.top(), "third");
+    EXPECT_EQ(restored.size(), 3);
+}
+
+// ==================== WORK STEALING DEQUE TESTS ====================
+TEST(WorkStealingDequeTest, OwnerLifoThiefFifoAndGrowth) {
+    WorkStealingDeque<int> deque(4);
+    EXPECT_EQ(deque.capacity(), 16);
+    EXPECT_TRUE(deque.empty());
+    
+    int value = -1;
+    EXPECT_FALSE(deque.pop(value));
+    EXPECT_FALSE(deque.steal(value));
+    EXPECT_EQ(value, -1);
+    
+    for (int i = 0; i < 100; i++) {
+        deque.push(i);
+    }
+    EXPECT_EQ(deque.size(), 100);
+    EXPECT_GE(deque.capacity(), 100);
+    
+    // Владелец берет свежие снизу, вор - старые сверху
+    EXPECT_TRUE(deque.pop(value));
+    EXPECT_EQ(value, 99);
+    EXPECT_TRUE(deque.steal(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(deque.steal(value));
+    EXPECT_EQ(value, 1);
+    
+    int expected = 98;
+    while (deque.pop(value)) {
+        EXPECT_EQ(value, expected--);
+    }
+    EXPECT_EQ(expected, 1);
+    EXPECT_TRUE(deque.empty());
+    
+    // После опустошения индексы продолжают расти, кольцо переиспользуется
+    size_t capacity = deque.capacity();
+    for (int round = 0; round < 50; round++) {
+        deque.push(round);
+        deque.push(round + 1000);
+        ASSERT_TRUE(deque.steal(value));
+        ASSERT_EQ(value, round);
+        ASSERT_TRUE(deque.pop(value));
+        ASSERT_EQ(value, round + 1000);
+    }
+    EXPECT_EQ(deque.capacity(), capacity);
+}
+
+TEST(WorkStealingDequeTest, ConcurrentThievesTakeEachItemOnce) {
+    const int items = 20000;
+    const int thieves = 3;
+    WorkStealingDeque<int> deque;
+    std::vector<std::atomic<int>> seen(items);
+    for (auto& flag : seen) {
+        flag.store(0);
+    }
+    std::atomic<int> taken(0);
+    
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thieves; t++) {
+        threads.emplace_back([&]() {
+            int value;
+            while (taken.load() < items) {
+                if (deque.steal(value)) {
+                    seen[value].fetch_add(1);
+                    taken.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    
+    // Владелец кладет пачками и сам забирает часть, соревнуясь с ворами
+    int value;
+    for (int i = 0; i < items; i++) {
+        deque.push(i);
+        if (i % 3 == 2 && deque.pop(value)) {
+            seen[value].fetch_add(1);
+            taken.fetch_add(1);
+        }
+    }
+    while (deque.pop(value)) {
+        seen[value].fetch_add(1);
+        taken.fetch_add(1);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    EXPECT_EQ(taken.load(), items);
+    for (const auto& flag : seen) {
+        ASSERT_EQ(flag.load(), 1);
+    }
+    EXPECT_TRUE(deque.empty());
+}
+
 // ==================== HASH TABLE TESTS ====================
 TEST_F(HashTableTest, DefaultConstructor) {
     HashTable ht;
@@ -1777,7 +4394,7 @@ protected:
         }
     }
     
-    Array arr_;
+    Array<std::string> arr_;
     SinglyLinkedList sll_;
     DoublyLinkedList dll_;
     Queue q_;
@@ -0,0 +1,320 @@
+#include "tieredarray.h"
+#include <utility>
+
+TieredArray::TieredArray()
+    : blocks(nullptr), blockCount(0), blockSlots(0), shift(MIN_SHIFT), currentSize(0) {}
+
+TieredArray::TieredArray(const TieredArray& other) : TieredArray() {
+    *this = other;
+}
+
+TieredArray::TieredArray(TieredArray&& other) noexcept
+    : blocks(other.blocks), blockCount(other.blockCount), blockSlots(other.blockSlots),
+      shift(other.shift), currentSize(other.currentSize) {
+    other.blocks = nullptr;
+    other.blockCount = 0;
+    other.blockSlots = 0;
+    other.shift = MIN_SHIFT;
+    other.currentSize = 0;
+}
+
+TieredArray& TieredArray::operator=(const TieredArray& other) {
+    if (this != &other) {
+        clear();
+        for (size_t i = 0; i < other.currentSize; ++i) {
+            insert(other.slot(i));
+        }
+    }
+    return *this;
+}
+
+TieredArray& TieredArray::operator=(TieredArray&& other) noexcept {
+    if (this != &other) {
+        clear();
+        delete[] blocks;
+        blocks = other.blocks;
+        blockCount = other.blockCount;
+        blockSlots = other.blockSlots;
+        shift = other.shift;
+        currentSize = other.currentSize;
+        other.blocks = nullptr;
+        other.blockCount = 0;
+        other.blockSlots = 0;
+        other.shift = MIN_SHIFT;
+        other.currentSize = 0;
+    }
+    return *this;
+}
+
+TieredArray::~TieredArray() {
+    clear();
+    delete[] blocks;
+}
+
+size_t TieredArray::blockCapacity() const {
+    return static_cast<size_t>(1) << shift;
+}
+
+size_t TieredArray::blockMask() const {
+    return blockCapacity() - 1;
+}
+
+std::string& TieredArray::slot(size_t index) const {
+    const Block& block = blocks[index >> shift];
+    return block.items[(block.head + (index & blockMask())) & blockMask()];
+}
+
+void TieredArray::addBlock() {
+    if (blockCount >= blockSlots) {
+        size_t newSlots = (blockSlots == 0) ? 4 : blockSlots * 2;
+        Block* newBlocks = new Block[newSlots];
+        for (size_t i = 0; i < blockCount; ++i) {
+            newBlocks[i] = blocks[i];
+        }
+        delete[] blocks;
+        blocks = newBlocks;
+        blockSlots = newSlots;
+    }
+    blocks[blockCount].items = new std::string[blockCapacity()];
+    blocks[blockCount].head = 0;
+    blockCount++;
+}
+
+void TieredArray::popBlock() {
+    blockCount--;
+    delete[] blocks[blockCount].items;
+}
+
+void TieredArray::rebuild(size_t newShift) {
+    size_t newCapacity = static_cast<size_t>(1) << newShift;
+    size_t newCount = (currentSize + newCapacity - 1) / newCapacity;
+    size_t newSlots = (newCount < 4) ? 4 : newCount * 2;
+    Block* newBlocks = new Block[newSlots];
+    
+    for (size_t b = 0; b < newCount; ++b) {
+        newBlocks[b].items = new std::string[newCapacity];
+        newBlocks[b].head = 0;
+    }
+    for (size_t i = 0; i < currentSize; ++i) {
+        newBlocks[i >> newShift].items[i & (newCapacity - 1)] = std::move(slot(i));
+    }
+    
+    for (size_t b = 0; b < blockCount; ++b) {
+        delete[] blocks[b].items;
+    }
+    delete[] blocks;
+    blocks = newBlocks;
+    blockCount = newCount;
+    blockSlots = newSlots;
+    shift = newShift;
+}
+
+void TieredArray::rebalance() {
+    // Держим B ~ sqrt(n): растим блок при n > 4B^2, уменьшаем при n < B^2/4
+    size_t capacity = blockCapacity();
+    if (currentSize > 4 * capacity * capacity) {
+        rebuild(shift + 1);
+    } else if (shift > MIN_SHIFT && currentSize < capacity * capacity / 4) {
+        rebuild(shift - 1);
+    }
+}
+
+void TieredArray::insert(const std::string& value) {
+    insertAt(currentSize, value);
+}
+
+void TieredArray::insertAt(size_t index, const std::string& value) {
+    if (index > currentSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    
+    size_t capacity = blockCapacity();
+    size_t mask = blockMask();
+    if (currentSize == blockCount * capacity) {
+        addBlock();
+    }
+    
+    size_t b = index >> shift;
+    size_t offset = index & mask;
+    size_t last = blockCount - 1;
+    Block& target = blocks[b];
+    
+    // В целевом блоке сдвигаем хвост вправо; из полного блока вытесняется последний элемент
+    size_t count = (b == last) ? currentSize - b * capacity : capacity;
+    std::string carry;
+    size_t end = count;
+    if (b != last) {
+        carry = std::move(target.items[(target.head + capacity - 1) & mask]);
+        end = capacity - 1;
+    }
+    for (size_t i = end; i > offset; --i) {
+        target.items[(target.head + i) & mask] = std::move(target.items[(target.head + i - 1) & mask]);
+    }
+    target.items[(target.head + offset) & mask] = value;
+    
+    // Вытесненный элемент становится первым в следующем блоке
+    for (size_t j = b + 1; j <= last; ++j) {
+        Block& block = blocks[j];
+        std::string next;
+        if (j != last) {
+            next = std::move(block.items[(block.head + capacity - 1) & mask]);
+        }
+        block.head = (block.head + capacity - 1) & mask;
+        block.items[block.head] = std::move(carry);
+        carry = std::move(next);
+    }
+    
+    currentSize++;
+    rebalance();
+}
+
+void TieredArray::remove(size_t index) {
+    if (index >= currentSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    
+    size_t capacity = blockCapacity();
+    size_t mask = blockMask();
+    size_t b = index >> shift;
+    size_t offset = index & mask;
+    size_t last = blockCount - 1;
+    Block& target = blocks[b];
+    
+    size_t count = (b == last) ? currentSize - b * capacity : capacity;
+    for (size_t i = offset; i + 1 < count; ++i) {
+        target.items[(target.head + i) & mask] = std::move(target.items[(target.head + i + 1) & mask]);
+    }
+    
+    // Первый элемент каждого следующего блока переезжает в конец предыдущего
+    for (size_t j = b + 1; j <= last; ++j) {
+        Block& block = blocks[j];
+        Block& previous = blocks[j - 1];
+        previous.items[(previous.head + capacity - 1) & mask] = std::move(block.items[block.head]);
+        block.head = (block.head + 1) & mask;
+    }
+    
+    currentSize--;
+    if (currentSize == last * capacity) {
+        popBlock();
+    }
+    rebalance();
+}
+
+std::string TieredArray::get(size_t index) const {
+    if (index >= currentSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    return slot(index);
+}
+
+void TieredArray::set(size_t index, const std::string& value) {
+    if (index >= currentSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    slot(index) = value;
+}
+
+size_t TieredArray::size() const {
+    return currentSize;
+}
+
+bool TieredArray::empty() const {
+    return currentSize == 0;
+}
+
+size_t TieredArray::getBlockSize() const {
+    return blockCapacity();
+}
+
+void TieredArray::clear() {
+    while (blockCount > 0) {
+        popBlock();
+    }
+    currentSize = 0;
+    shift = MIN_SHIFT;
+}
+
+void TieredArray::print() const {
+    std::cout << "[";
+    for (size_t i = 0; i < currentSize; ++i) {
+        std::cout << "\"" << slot(i) << "\"";
+        if (i < currentSize - 1) std::cout << ", ";
+    }
+    std::cout << "]" << std::endl;
+}
+
+void TieredArray::serialize(std::ostream& os) const {
+    os.write(reinterpret_cast<const char*>(&currentSize), sizeof(currentSize));
+    for (size_t i = 0; i < currentSize; ++i) {
+        const std::string& value = slot(i);
+        size_t strLen = value.length();
+        os.write(reinterpret_cast<const char*>(&strLen), sizeof(strLen));
+        os.write(value.c_str(), strLen);
+    }
+}
+
+void TieredArray::deserialize(std::istream& is) {
+    size_t arrSize;
+    is.read(reinterpret_cast<char*>(&arrSize), sizeof(arrSize));
+    
+    clear();
+    for (size_t i = 0; i < arrSize; ++i) {
+        size_t strLen;
+        is.read(reinterpret_cast<char*>(&strLen), sizeof(strLen));
+        std::string value(strLen, ' ');
+        is.read(&value[0], strLen);
+        insert(value);
+    }
+}
+
+// Текстовая сериализация
+void TieredArray::serializeText(std::ostream& os) const {
+    os << currentSize << "\n";
+    for (size_t i = 0; i < currentSize; ++i) {
+        // Экранируем специальные символы
+        std::string escaped = slot(i);
+        size_t pos = 0;
+        while ((pos = escaped.find('\n', pos)) != std::string::npos) {
+            escaped.replace(pos, 1, "\\n");
+            pos += 2;
+        }
+        pos = 0;
+        while ((pos = escaped.find('\"', pos)) != std::string::npos) {
+            escaped.replace(pos, 1, "\\\"");
+            pos += 2;
+        }
+        os << "\"" << escaped << "\"\n";
+    }
+}
+
+// Текстовая десериализация
+void TieredArray::deserializeText(std::istream& is) {
+    size_t newSize;
+    is >> newSize;
+    is.get(); // Пропускаем перевод строки
+    
+    clear();
+    
+    for (size_t i = 0; i < newSize; ++i) {
+        std::string line;
+        std::getline(is, line);
+        
+        // Убираем обрамляющие кавычки и разэкранируем
+        if (line.size() >= 2 && line.front() == '\"' && line.back() == '\"') {
+            line = line.substr(1, line.size() - 2);
+            
+            size_t pos = 0;
+            while ((pos = line.find("\\n", pos)) != std::string::npos) {
+                line.replace(pos, 2, "\n");
+                pos += 1;
+            }
+            pos = 0;
+            while ((pos = line.find("\\\"", pos)) != std::string::npos) {
+                line.replace(pos, 2, "\"");
+                pos += 1;
+            }
+        }
+        
+        insert(line);
+    }
+}
@@ -0,0 +1,69 @@
+#ifndef TIEREDARRAY_H
+#define TIEREDARRAY_H
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+// Многоуровневый массив (tiered vector): элементы лежат в блоках одинакового
+// размера B ~ sqrt(n), каждый блок - кольцевой буфер. Все блоки, кроме
+// последнего, заполнены полностью, поэтому get(i) остается O(1), а вставка и
+// удаление по индексу сдвигают элементы внутри одного блока и перекладывают
+// по одному элементу между соседними блоками: O(B + n/B) = O(sqrt(n)).
+// Интерфейс и формат сериализации совпадают с Array.
+class TieredArray {
+private:
+    struct Block {
+        std::string* items;
+        size_t head;
+    };
+    
+    static const size_t MIN_SHIFT = 3;
+    
+    Block* blocks;
+    size_t blockCount;
+    size_t blockSlots;
+    size_t shift;          // log2 размера блока
+    size_t currentSize;
+    
+    size_t blockCapacity() const;
+    size_t blockMask() const;
+    std::string& slot(size_t index) const;
+    
+    void addBlock();
+    void popBlock();
+    void rebuild(size_t newShift);
+    void rebalance();
+
+public:
+    TieredArray();
+    TieredArray(const TieredArray& other);
+    TieredArray(TieredArray&& other) noexcept;
+    TieredArray& operator=(const TieredArray& other);
+    TieredArray& operator=(TieredArray&& other) noexcept;
+    ~TieredArray();
+    
+    void insert(const std::string& value);
+    void insertAt(size_t index, const std::string& value);
+    void remove(size_t index);
+    std::string get(size_t index) const;
+    void set(size_t index, const std::string& value);
+    size_t size() const;
+    bool empty() const;
+    
+    // Текущий размер блока (для тестов и бенчмарков)
+    size_t getBlockSize() const;
+    
+    void clear();
+    void print() const;
+    
+    // Бинарная сериализация (совместима с Array)
+    void serialize(std::ostream& os) const;
+    void deserialize(std::istream& is);
+    
+    // Текстовая сериализация
+    void serializeText(std::ostream& os) const;
+    void deserializeText(std::istream& is);
+};
+
+#endif
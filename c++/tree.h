@@ -9,7 +9,7 @@
 
 class CompleteBinaryTree {
 private:
-    Array tree;
+    Array<std::string> tree;
     
     static size_t parent(size_t index);
     static size_t leftChild(size_t index);
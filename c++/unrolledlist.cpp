@@ -0,0 +1,352 @@
+#include "unrolledlist.h"
+#include <utility>
+
+UnrolledList::UnrolledList() : pool(), head(nullptr), tail(nullptr), listSize(0), blocks(0) {}
+
+UnrolledList::~UnrolledList() {
+    clear();
+}
+
+UnrolledList::UnrolledList(const UnrolledList& other)
+    : pool(), head(nullptr), tail(nullptr), listSize(0), blocks(0) {
+    *this = other;
+}
+
+UnrolledList& UnrolledList::operator=(const UnrolledList& other) {
+    if (this != &other) {
+        clear();
+        for (Block* block = other.head; block != nullptr; block = block->next) {
+            for (size_t i = 0; i < block->count; ++i) {
+                push_back(block->items[i]);
+            }
+        }
+    }
+    return *this;
+}
+
+UnrolledList::Block* UnrolledList::locate(size_t& index) const {
+    // Идем с ближайшего конца, пропуская блоки целиком
+    if (index < listSize / 2) {
+        Block* block = head;
+        while (index >= block->count) {
+            index -= block->count;
+            block = block->next;
+        }
+        return block;
+    }
+    size_t end = listSize;
+    Block* block = tail;
+    while (index < end - block->count) {
+        end -= block->count;
+        block = block->prev;
+    }
+    index -= end - block->count;
+    return block;
+}
+
+UnrolledList::Block* UnrolledList::insertBlockAfter(Block* block) {
+    Block* created = pool.create();
+    if (block == nullptr) {
+        created->next = head;
+        if (head != nullptr) {
+            head->prev = created;
+        } else {
+            tail = created;
+        }
+        head = created;
+    } else {
+        created->prev = block;
+        created->next = block->next;
+        if (block->next != nullptr) {
+            block->next->prev = created;
+        } else {
+            tail = created;
+        }
+        block->next = created;
+    }
+    blocks++;
+    return created;
+}
+
+void UnrolledList::unlinkBlock(Block* block) {
+    if (block->prev != nullptr) {
+        block->prev->next = block->next;
+    } else {
+        head = block->next;
+    }
+    if (block->next != nullptr) {
+        block->next->prev = block->prev;
+    } else {
+        tail = block->prev;
+    }
+    pool.destroy(block);
+    blocks--;
+}
+
+void UnrolledList::splitBlock(Block* block) {
+    Block* created = insertBlockAfter(block);
+    size_t half = block->count / 2;
+    for (size_t i = half; i < block->count; ++i) {
+        created->items[i - half] = std::move(block->items[i]);
+        block->items[i] = std::string();
+    }
+    created->count = block->count - half;
+    block->count = half;
+}
+
+void UnrolledList::mergeWithNext(Block* block) {
+    Block* next = block->next;
+    for (size_t i = 0; i < next->count; ++i) {
+        block->items[block->count + i] = std::move(next->items[i]);
+    }
+    block->count += next->count;
+    unlinkBlock(next);
+}
+
+void UnrolledList::push_front(const std::string& value) {
+    insert(0, value);
+}
+
+void UnrolledList::push_back(const std::string& value) {
+    if (tail == nullptr || tail->count == BLOCK_CAPACITY) {
+        insertBlockAfter(tail);
+    }
+    tail->items[tail->count++] = value;
+    listSize++;
+}
+
+void UnrolledList::pop_front() {
+    if (empty()) {
+        throw std::runtime_error("List is empty");
+    }
+    remove(0);
+}
+
+void UnrolledList::pop_back() {
+    if (empty()) {
+        throw std::runtime_error("List is empty");
+    }
+    remove(listSize - 1);
+}
+
+void UnrolledList::insert(size_t index, const std::string& value) {
+    if (index > listSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    
+    if (index == listSize) {
+        push_back(value);
+        return;
+    }
+    
+    size_t offset = index;
+    Block* block = locate(offset);
+    if (block->count == BLOCK_CAPACITY && block == head && offset == 0) {
+        // Серия push_front заполняет новые блоки целиком, а не делит старые
+        block = insertBlockAfter(nullptr);
+    } else if (block->count == BLOCK_CAPACITY) {
+        splitBlock(block);
+        if (offset >= block->count) {
+            offset -= block->count;
+            block = block->next;
+        }
+    }
+    
+    for (size_t i = block->count; i > offset; --i) {
+        block->items[i] = std::move(block->items[i - 1]);
+    }
+    block->items[offset] = value;
+    block->count++;
+    listSize++;
+}
+
+void UnrolledList::remove(size_t index) {
+    if (index >= listSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    
+    size_t offset = index;
+    Block* block = locate(offset);
+    for (size_t i = offset; i + 1 < block->count; ++i) {
+        block->items[i] = std::move(block->items[i + 1]);
+    }
+    block->count--;
+    block->items[block->count] = std::string();
+    listSize--;
+    
+    if (block->count == 0) {
+        unlinkBlock(block);
+    } else if (block->next != nullptr && block->count + block->next->count <= BLOCK_CAPACITY / 2) {
+        // Сливаем полупустые соседние блоки, чтобы список не вырождался в обычный
+        mergeWithNext(block);
+    } else if (block->prev != nullptr && block->prev->count + block->count <= BLOCK_CAPACITY / 2) {
+        mergeWithNext(block->prev);
+    }
+}
+
+std::string UnrolledList::get(size_t index) const {
+    if (index >= listSize) {
+        throw std::out_of_range("Index out of range");
+    }
+    
+    Block* block = locate(index);
+    return block->items[index];
+}
+
+size_t UnrolledList::size() const {
+    return listSize;
+}
+
+bool UnrolledList::empty() const {
+    return listSize == 0;
+}
+
+size_t UnrolledList::blockCount() const {
+    return blocks;
+}
+
+void UnrolledList::clear() {
+    while (head != nullptr) {
+        Block* temp = head;
+        head = head->next;
+        pool.destroy(temp);
+    }
+    pool.releaseAll();
+    tail = nullptr;
+    listSize = 0;
+    blocks = 0;
+}
+
+void UnrolledList::print() const {
+    if (empty()) {
+        std::cout << "UnrolledList: [empty]" << std::endl;
+        return;
+    }
+    
+    std::cout << "UnrolledList: [";
+    size_t printed = 0;
+    for (Block* block = head; block != nullptr; block = block->next) {
+        for (size_t i = 0; i < block->count; ++i) {
+            std::cout << "\"" << block->items[i] << "\"";
+            if (++printed < listSize) std::cout << " <-> ";
+        }
+    }
+    std::cout << "]" << std::endl;
+}
+
+void UnrolledList::serialize(std::ostream& os) const {
+    os.write(reinterpret_cast<const char*>(&listSize), sizeof(listSize));
+    for (Block* block = head; block != nullptr; block = block->next) {
+        for (size_t i = 0; i < block->count; ++i) {
+            size_t strLen = block->items[i].length();
+            os.write(reinterpret_cast<const char*>(&strLen), sizeof(strLen));
+            os.write(block->items[i].c_str(), strLen);
+        }
+    }
+}
+
+void UnrolledList::deserialize(std::istream& is) {
+    clear();
+    size_t listSizeValue;
+    is.read(reinterpret_cast<char*>(&listSizeValue), sizeof(listSizeValue));
+    
+    for (size_t i = 0; i < listSizeValue; ++i) {
+        size_t strLen;
+        is.read(reinterpret_cast<char*>(&strLen), sizeof(strLen));
+        std::string value(strLen, ' ');
+        is.read(&value[0], strLen);
+        push_back(value);
+    }
+}
+
+void UnrolledList::serializeText(std::ostream& os) const {
+    os << listSize << "\n";
+    for (Block* block = head; block != nullptr; block = block->next) {
+        for (size_t i = 0; i < block->count; ++i) {
+            std::string escaped = block->items[i];
+            size_t pos = 0;
+            while ((pos = escaped.find('\n', pos)) != std::string::npos) {
+                escaped.replace(pos, 1, "\\n");
+                pos += 2;
+            }
+            pos = 0;
+            while ((pos = escaped.find('\"', pos)) != std::string::npos) {
+                escaped.replace(pos, 1, "\\\"");
+                pos += 2;
+            }
+            os << "\"" << escaped << "\"\n";
+        }
+    }
+}
+
+void UnrolledList::deserializeText(std::istream& is) {
+    clear();
+    size_t newSize;
+    is >> newSize;
+    is.get();
+    
+    for (size_t i = 0; i < newSize; ++i) {
+        std::string line;
+        std::getline(is, line);
+        
+        if (line.size() >= 2 && line.front() == '\"' && line.back() == '\"') {
+            line = line.substr(1, line.size() - 2);
+            
+            size_t pos = 0;
+            while ((pos = line.find("\\n", pos)) != std::string::npos) {
+                line.replace(pos, 2, "\n");
+                pos += 1;
+            }
+            pos = 0;
+            while ((pos = line.find("\\\"", pos)) != std::string::npos) {
+                line.replace(pos, 2, "\"");
+                pos += 1;
+            }
+        }
+        
+        push_back(line);
+    }
+}
+
+bool UnrolledList::checkIntegrity() const {
+    if (empty()) {
+        return head == nullptr && tail == nullptr && blocks == 0;
+    }
+    
+    // Прямой проход: связи prev, отсутствие пустых блоков, сумма размеров
+    size_t count = 0;
+    size_t blockTotal = 0;
+    const Block* previous = nullptr;
+    for (Block* block = head; block != nullptr; block = block->next) {
+        if (block->prev != previous || block->count == 0 || block->count > BLOCK_CAPACITY) {
+            return false;
+        }
+        count += block->count;
+        blockTotal++;
+        previous = block;
+    }
+    
+    return count == listSize && blockTotal == blocks && previous == tail;
+}
+
+std::vector<std::string> UnrolledList::toVector() const {
+    std::vector<std::string> result;
+    result.reserve(listSize);
+    for (Block* block = head; block != nullptr; block = block->next) {
+        for (size_t i = 0; i < block->count; ++i) {
+            result.push_back(block->items[i]);
+        }
+    }
+    return result;
+}
+
+bool UnrolledList::contains(const std::string& value) const {
+    for (Block* block = head; block != nullptr; block = block->next) {
+        for (size_t i = 0; i < block->count; ++i) {
+            if (block->items[i] == value) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
@@ -0,0 +1,76 @@
+#ifndef UNROLLEDLIST_H
+#define UNROLLEDLIST_H
+
+#include "nodepool.h"
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Развернутый (unrolled) двусвязный список: каждый узел хранит до
+// BLOCK_CAPACITY строк подряд, поэтому проход по списку и поиск позиции
+// делают один переход по указателю на блок, а не на каждый элемент.
+// Переполненный блок делится пополам, полупустой сливается с соседом.
+// Интерфейс и формат сериализации совпадают с SinglyLinkedList/DoublyLinkedList.
+class UnrolledList {
+public:
+    static const size_t BLOCK_CAPACITY = 16;
+
+private:
+    struct Block {
+        std::string items[BLOCK_CAPACITY];
+        size_t count;
+        Block* next;
+        Block* prev;
+        Block() : count(0), next(nullptr), prev(nullptr) {}
+    };
+    
+    NodePool<Block> pool;
+    Block* head;
+    Block* tail;
+    size_t listSize;
+    size_t blocks;
+    
+    // Находит блок с элементом index; index превращается в смещение внутри блока
+    Block* locate(size_t& index) const;
+    Block* insertBlockAfter(Block* block);
+    void unlinkBlock(Block* block);
+    void splitBlock(Block* block);
+    void mergeWithNext(Block* block);
+
+public:
+    UnrolledList();
+    ~UnrolledList();
+    UnrolledList(const UnrolledList& other);
+    UnrolledList& operator=(const UnrolledList& other);
+    
+    void push_front(const std::string& value);
+    void push_back(const std::string& value);
+    void pop_front();
+    void pop_back();
+    void insert(size_t index, const std::string& value);
+    void remove(size_t index);
+    std::string get(size_t index) const;
+    size_t size() const;
+    bool empty() const;
+    
+    // Количество блоков (для тестов и бенчмарков)
+    size_t blockCount() const;
+    
+    bool checkIntegrity() const;
+    std::vector<std::string> toVector() const;
+    bool contains(const std::string& value) const;
+    
+    void clear();
+    void print() const;
+    
+    // Бинарная сериализация (совместима со связными списками)
+    void serialize(std::ostream& os) const;
+    void deserialize(std::istream& is);
+    
+    // Текстовая сериализация
+    void serializeText(std::ostream& os) const;
+    void deserializeText(std::istream& is);
+};
+
+#endif
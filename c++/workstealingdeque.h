@@ -0,0 +1,153 @@
+#ifndef WORKSTEALINGDEQUE_H
+#define WORKSTEALINGDEQUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+// Дек с кражей работы (Chase-Lev) для планировщиков задач. Владелец
+// кладет и забирает задачи с нижнего конца (push/pop, LIFO - свежие задачи
+// горячие в кэше), остальные потоки крадут с верхнего конца (steal, FIFO -
+// самые старые и обычно самые крупные задачи). Все операции lock-free:
+// владелец конфликтует с вором только за последний элемент, воры между
+// собой - за вершину. Кольцевой буфер растет вдвое, когда заполнен; старые
+// буферы живут до разрушения дека, потому что вор мог успеть их прочитать.
+// Элементы копируются побитово, поэтому T - тривиально копируемый тип
+// (указатель на задачу, индекс, небольшая структура).
+template<typename T>
+class WorkStealingDeque {
+private:
+    static_assert(std::is_trivially_copyable<T>::value, "WorkStealingDeque stores trivially copyable values");
+    
+    static const size_t CACHE_LINE = 64;
+    static const size_t MIN_CAPACITY = 16;
+    
+    struct Ring {
+        size_t mask;
+        std::atomic<T>* cells;
+        
+        explicit Ring(size_t capacity) : mask(capacity - 1), cells(new std::atomic<T>[capacity]) {}
+        ~Ring() { delete[] cells; }
+        
+        T get(int64_t index) const {
+            return cells[static_cast<size_t>(index) & mask].load(std::memory_order_relaxed);
+        }
+        
+        void put(int64_t index, T value) {
+            cells[static_cast<size_t>(index) & mask].store(value, std::memory_order_relaxed);
+        }
+    };
+    
+    // top меняют воры, bottom - только владелец: держим их в разных линиях кэша
+    alignas(CACHE_LINE) std::atomic<int64_t> top;
+    alignas(CACHE_LINE) std::atomic<int64_t> bottom;
+    alignas(CACHE_LINE) std::atomic<Ring*> ring;
+    std::vector<Ring*> retired;   // Трогает только владелец
+    
+    static size_t roundUpCapacity(size_t capacity) {
+        size_t result = MIN_CAPACITY;
+        while (result < capacity) {
+            result *= 2;
+        }
+        return result;
+    }
+    
+    Ring* grow(Ring* old, int64_t from, int64_t to) {
+        Ring* bigger = new Ring((old->mask + 1) * 2);
+        for (int64_t i = from; i < to; ++i) {
+            bigger->put(i, old->get(i));
+        }
+        retired.push_back(old);
+        ring.store(bigger, std::memory_order_release);
+        return bigger;
+    }
+
+public:
+    explicit WorkStealingDeque(size_t initialCapacity = MIN_CAPACITY)
+        : top(0), bottom(0), ring(new Ring(roundUpCapacity(initialCapacity))), retired() {}
+    
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    
+    ~WorkStealingDeque() {
+        delete ring.load(std::memory_order_relaxed);
+        for (Ring* old : retired) {
+            delete old;
+        }
+    }
+    
+    // Только поток-владелец
+    void push(T value) {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_acquire);
+        Ring* current = ring.load(std::memory_order_relaxed);
+        if (b - t > static_cast<int64_t>(current->mask)) {
+            current = grow(current, t, b);
+        }
+        current->put(b, value);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    
+    // Только поток-владелец; false, если дек пуст
+    bool pop(T& out) {
+        int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        Ring* current = ring.load(std::memory_order_relaxed);
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top.load(std::memory_order_relaxed);
+        
+        if (t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+        T value = current->get(b);
+        if (t == b) {
+            // Последний элемент: спорим с ворами за вершину
+            bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                                   std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            if (!won) {
+                return false;
+            }
+        }
+        out = value;
+        return true;
+    }
+    
+    // Любой поток; false, если дек пуст или вершину перехватил другой поток
+    bool steal(T& out) {
+        int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b) {
+            return false;
+        }
+        T value = ring.load(std::memory_order_acquire)->get(t);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                         std::memory_order_relaxed)) {
+            return false;
+        }
+        out = value;
+        return true;
+    }
+    
+    // Снимок размера; при одновременных операциях может сразу устареть
+    size_t size() const {
+        int64_t b = bottom.load(std::memory_order_relaxed);
+        int64_t t = top.load(std::memory_order_relaxed);
+        return b > t ? static_cast<size_t>(b - t) : 0;
+    }
+    
+    bool empty() const {
+        return size() == 0;
+    }
+    
+    size_t capacity() const {
+        return ring.load(std::memory_order_relaxed)->mask + 1;
+    }
+};
+
+#endif